@@ -1,5 +1,7 @@
 #include "init_srs.hpp"
+#include "barretenberg/srs/factories/mem_prover_crs.hpp"
 #include "barretenberg/srs/global_crs.hpp"
+#include "barretenberg/srs/point_table_cache.hpp"
 #include "get_bn254_crs.hpp"
 #include "get_grumpkin_crs.hpp"
 
@@ -12,6 +14,28 @@ std::string getHomeDir()
     return home != nullptr ? std::string(home) : "./";
 }
 
+namespace {
+/**
+ * @brief Map the prover point table from the cache in CRS_PATH, or compute it from the (downloaded) points and write
+ * the cache so that later processes can map it
+ *
+ * @param get_points Returns the first given number of CRS points
+ */
+template <typename Curve>
+std::shared_ptr<srs::factories::ProverCrs<Curve>> get_cached_prover_crs(size_t num_points, const auto& get_points)
+{
+    using Cache = srs::PointTableCache<Curve>;
+    const auto cache_path = Cache::get_path(CRS_PATH);
+    const uint64_t transcript_digest = Cache::compute_digest(get_points(Cache::DIGEST_NUM_POINTS));
+    if (auto point_table = Cache::load(cache_path, num_points, transcript_digest)) {
+        return std::make_shared<srs::factories::MemProverCrs<Curve>>(std::move(point_table), num_points);
+    }
+    auto prover_crs = std::make_shared<srs::factories::MemProverCrs<Curve>>(get_points(num_points));
+    Cache::store(cache_path, prover_crs->get_monomial_points());
+    return prover_crs;
+}
+} // namespace
+
 /**
  * @brief Initialize the global crs_factory for bn254 based on a known dyadic circuit size
  *
@@ -20,9 +44,11 @@ std::string getHomeDir()
 void init_bn254_crs(size_t dyadic_circuit_size)
 {
     // Must +1 for Plonk only!
-    auto bn254_g1_data = get_bn254_g1_data(CRS_PATH, dyadic_circuit_size + 1);
+    const size_t num_points = dyadic_circuit_size + 1;
+    auto prover_crs = get_cached_prover_crs<curve::BN254>(
+        num_points, [](size_t count) { return get_bn254_g1_data(CRS_PATH, count); });
     auto bn254_g2_data = get_bn254_g2_data(CRS_PATH);
-    srs::init_crs_factory(bn254_g1_data, bn254_g2_data);
+    srs::init_crs_factory(std::move(prover_crs), bn254_g2_data);
 }
 
 /**
@@ -33,7 +59,9 @@ void init_bn254_crs(size_t dyadic_circuit_size)
  */
 void init_grumpkin_crs(size_t eccvm_dyadic_circuit_size)
 {
-    auto grumpkin_g1_data = get_grumpkin_g1_data(CRS_PATH, eccvm_dyadic_circuit_size + 1);
-    srs::init_grumpkin_crs_factory(grumpkin_g1_data);
+    const size_t num_points = eccvm_dyadic_circuit_size + 1;
+    auto prover_crs = get_cached_prover_crs<curve::Grumpkin>(
+        num_points, [](size_t count) { return get_grumpkin_g1_data(CRS_PATH, count); });
+    srs::init_grumpkin_crs_factory(std::move(prover_crs));
 }
 } // namespace bb
@@ -4,7 +4,9 @@
 #include "barretenberg/api/api_ultra_plonk.hpp"
 #include "barretenberg/api/gate_count.hpp"
 #include "barretenberg/api/prove_tube.hpp"
+#include "barretenberg/api/file_io.hpp"
 #include "barretenberg/bb/cli11_formatter.hpp"
+#include "barretenberg/common/stats.hpp"
 #include "barretenberg/plonk_honk_shared/types/aggregation_object_type.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_rollup_flavor.hpp"
 
@@ -86,6 +88,7 @@ int main(int argc, char* argv[])
     }; // sometimes a directory where things will be written, sometimes the path of a file to be written
     std::filesystem::path proof_path{ "./target/proof" };
     std::filesystem::path vk_path{ "./target/vk" };
+    std::filesystem::path stats_out_path;
     flags.scheme = "";
     flags.oracle_hash_type = "poseidon2";
     flags.output_format = "bytes";
@@ -299,6 +302,10 @@ int main(int argc, char* argv[])
     add_honk_recursion_option(prove);
 
     prove->add_flag("--verify", "Verify the proof natively, resulting in a boolean output. Useful for testing.");
+    prove->add_option("--stats-out",
+                      stats_out_path,
+                      "Write the time and thread utilization of each proving phase, the peak memory usage and the "
+                      "sizes of the MSMs and sumchecks to this path as JSON.");
 
     /***************************************************************************************************************
      * Subcommand: write_vk
@@ -687,7 +694,14 @@ int main(int argc, char* argv[])
             return 0;
         }
         if (prove->parsed()) {
-            api.prove(flags, bytecode_path, witness_path, output_path);
+            {
+                BB_STATS_PHASE("prove");
+                api.prove(flags, bytecode_path, witness_path, output_path);
+            }
+            if (!stats_out_path.empty()) {
+                const std::string stats = stats::Stats::get().to_json();
+                write_file(stats_out_path, std::vector<uint8_t>(stats.begin(), stats.end()));
+            }
             return 0;
         }
         if (write_vk->parsed()) {
@@ -31,6 +31,18 @@
 
 using namespace benchmark;
 using namespace bb;
+
+#ifndef NO_MULTITHREADING
+// The individual parallel_for backends, see thread.cpp
+namespace bb {
+void parallel_for_spawning(size_t num_iterations, const std::function<void(size_t)>& func);
+void parallel_for_queued(size_t num_iterations, const std::function<void(size_t)>& func);
+void parallel_for_atomic_pool(size_t num_iterations, const std::function<void(size_t)>& func);
+void parallel_for_mutex_pool(size_t num_iterations, const std::function<void(size_t)>& func);
+void parallel_for_work_stealing(size_t num_iterations, const std::function<void(size_t)>& func);
+} // namespace bb
+#endif
+
 namespace {
 using Curve = curve::BN254;
 using Fr = Curve::ScalarField;
@@ -69,6 +81,61 @@ void parallel_for_field_element_addition(State& state)
     }
 }
 
+#ifndef NO_MULTITHREADING
+using ParallelForBackend = void (*)(size_t, const std::function<void(size_t)>&);
+
+/**
+ * @brief Compare the parallel_for backends on an unbalanced flat loop
+ *
+ * @details Every iteration performs a number of field multiplications proportional to its index, so backends that hand
+ * out work in static chunks end up waiting on the slowest thread at the tail. The argument is log2 of the number of
+ * iterations.
+ */
+template <ParallelForBackend backend> void parallel_for_backend_flat(State& state)
+{
+    const size_t num_iterations = 1UL << static_cast<size_t>(state.range(0));
+    std::vector<Fr> values(num_iterations, Fr(7));
+    for (auto _ : state) {
+        backend(num_iterations, [&](size_t i) {
+            for (size_t j = 0; j < (i & 255); j++) {
+                values[i] *= values[i];
+            }
+        });
+    }
+    DoNotOptimize(values);
+}
+
+/**
+ * @brief Compare the parallel_for backends on a nested loop (e.g. parallel commitments inside parallel sumcheck)
+ *
+ * @details Only the work-stealing backend supports nesting, the flat pools run the inner loop serially in the outer
+ * loop's iterations, as our code did before. The argument is log2 of the number of inner iterations.
+ */
+template <ParallelForBackend backend, bool nested> void parallel_for_backend_nested(State& state)
+{
+    const size_t num_outer = 4;
+    const size_t num_inner = 1UL << static_cast<size_t>(state.range(0));
+    std::vector<std::vector<Fr>> values(num_outer, std::vector<Fr>(num_inner, Fr(7)));
+    for (auto _ : state) {
+        backend(num_outer, [&](size_t i) {
+            auto inner = [&](size_t j) {
+                for (size_t k = 0; k < 64; k++) {
+                    values[i][j] *= values[i][j];
+                }
+            };
+            if constexpr (nested) {
+                backend(num_inner, inner);
+            } else {
+                for (size_t j = 0; j < num_inner; j++) {
+                    inner(j);
+                }
+            }
+        });
+    }
+    DoNotOptimize(values);
+}
+#endif
+
 /**
  * @brief Evaluate how much finite addition costs (in cache)
  *
@@ -483,6 +550,16 @@ void bn254fr_random(State& state)
 } // namespace
 
 BENCHMARK(parallel_for_field_element_addition)->Unit(kMicrosecond)->DenseRange(0, MAX_REPETITION_LOG);
+#ifndef NO_MULTITHREADING
+BENCHMARK_TEMPLATE(parallel_for_backend_flat, parallel_for_spawning)->Unit(kMicrosecond)->DenseRange(4, 12, 4);
+BENCHMARK_TEMPLATE(parallel_for_backend_flat, parallel_for_queued)->Unit(kMicrosecond)->DenseRange(4, 12, 4);
+BENCHMARK_TEMPLATE(parallel_for_backend_flat, parallel_for_atomic_pool)->Unit(kMicrosecond)->DenseRange(4, 12, 4);
+BENCHMARK_TEMPLATE(parallel_for_backend_flat, parallel_for_mutex_pool)->Unit(kMicrosecond)->DenseRange(4, 12, 4);
+BENCHMARK_TEMPLATE(parallel_for_backend_flat, parallel_for_work_stealing)->Unit(kMicrosecond)->DenseRange(4, 12, 4);
+BENCHMARK_TEMPLATE(parallel_for_backend_nested, parallel_for_mutex_pool, false)->Unit(kMicrosecond)->DenseRange(8, 16, 4);
+BENCHMARK_TEMPLATE(parallel_for_backend_nested, parallel_for_work_stealing, false)->Unit(kMicrosecond)->DenseRange(8, 16, 4);
+BENCHMARK_TEMPLATE(parallel_for_backend_nested, parallel_for_work_stealing, true)->Unit(kMicrosecond)->DenseRange(8, 16, 4);
+#endif
 BENCHMARK(ff_addition)->Unit(kMicrosecond)->DenseRange(12, 30);
 BENCHMARK(ff_multiplication)->Unit(kMicrosecond)->DenseRange(12, 27);
 BENCHMARK(ff_sqr)->Unit(kMicrosecond)->DenseRange(12, 27);
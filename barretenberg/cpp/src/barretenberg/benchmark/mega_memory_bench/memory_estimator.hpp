@@ -46,7 +46,7 @@ class MegaMemoryEstimator {
                 size += wire.capacity() * sizeof(uint32_t);
             }
             for (const auto& selector : block.selectors) {
-                size += selector.capacity() * sizeof(FF);
+                size += selector.memory_usage();
             }
             vinfo(label, " size ", size >> 10, " KiB");
             result += size;
@@ -1,5 +1,6 @@
 #include "barretenberg/common/assert.hpp"
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/scalar_multiplication/bucket_msm.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
 #include "barretenberg/srs/factories/file_crs_factory.hpp"
@@ -8,6 +9,7 @@
 
 #include <chrono>
 #include <cstdlib>
+#include <limits>
 
 // #include <valgrind/callgrind.h>
 //  CALLGRIND_START_INSTRUMENTATION;
@@ -64,8 +66,12 @@ const auto init = []() {
 };
 // constexpr double add_to_mixed_add_complexity = 1.36;
 
-auto reference_string =
-    std::make_shared<bb::srs::factories::FileProverCrs<curve::BN254>>(NUM_POINTS, bb::srs::get_ignition_crs_path());
+// The MSM engine comparison runs over 2^12..2^22 points
+constexpr size_t MIN_LOG_MSM_POINTS = 12;
+constexpr size_t MAX_LOG_MSM_POINTS = 22;
+
+auto reference_string = std::make_shared<bb::srs::factories::FileProverCrs<curve::BN254>>(
+    1UL << MAX_LOG_MSM_POINTS, bb::srs::get_ignition_crs_path());
 
 int pippenger()
 {
@@ -82,6 +88,55 @@ int pippenger()
     return 0;
 }
 
+/**
+ * @brief Compare the wNAF pippenger (as used by commitments until now) against the bucket MSM, at powers of 2 and at
+ * sizes just above a power of 2, where the former has to pad almost to the next power of 2.
+ */
+int compare_msm_engines()
+{
+    using Curve = curve::BN254;
+    constexpr size_t NUM_REPETITIONS = 3;
+    std::vector<fr> msm_scalars(1UL << MAX_LOG_MSM_POINTS);
+    for (auto& scalar : msm_scalars) {
+        scalar = fr::random_element();
+    }
+    std::span<const g1::affine_element> point_table = reference_string->get_monomial_points();
+    scalar_multiplication::pippenger_runtime_state<Curve> state(1UL << MAX_LOG_MSM_POINTS);
+
+    const auto time_us = [](auto&& func) {
+        int64_t best = std::numeric_limits<int64_t>::max();
+        for (size_t i = 0; i < NUM_REPETITIONS; ++i) {
+            auto time_start = std::chrono::steady_clock::now();
+            func();
+            auto time_end = std::chrono::steady_clock::now();
+            best = std::min(best,
+                            std::chrono::duration_cast<std::chrono::microseconds>(time_end - time_start).count());
+        }
+        return best;
+    };
+
+    std::cout << "num_points, pippenger_unsafe_optimized_for_non_dyadic_polys (us), BucketMSM (us), speedup"
+              << std::endl;
+    for (size_t log_n = MIN_LOG_MSM_POINTS; log_n <= MAX_LOG_MSM_POINTS; ++log_n) {
+        const size_t dyadic_size = 1UL << log_n;
+        for (const size_t num_points : { dyadic_size, dyadic_size / 2 + dyadic_size / 16 }) {
+            PolynomialSpan<const fr> span{ 0, { msm_scalars.data(), num_points } };
+            g1::element old_result;
+            g1::element new_result;
+            const int64_t old_time = time_us([&]() {
+                old_result = scalar_multiplication::pippenger_unsafe_optimized_for_non_dyadic_polys<Curve>(
+                    span, point_table, state);
+            });
+            const int64_t new_time =
+                time_us([&]() { new_result = scalar_multiplication::BucketMSM<Curve>::msm(span, point_table); });
+            ASSERT(old_result == new_result);
+            std::cout << num_points << ", " << old_time << ", " << new_time << ", "
+                      << static_cast<double>(old_time) / static_cast<double>(new_time) << std::endl;
+        }
+    }
+    return 0;
+}
+
 int coset_fft_split()
 {
     std::chrono::steady_clock::time_point time_start = std::chrono::steady_clock::now();
@@ -117,5 +172,7 @@ int main()
     pippenger();
     pippenger();
     pippenger();
+    std::cout << "comparing msm engines" << std::endl;
+    compare_msm_engines();
     return 0;
 }
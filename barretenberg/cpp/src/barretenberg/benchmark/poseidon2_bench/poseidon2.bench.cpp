@@ -41,4 +41,41 @@ void poseiden_hash_bench(State& state) noexcept
 }
 BENCHMARK(poseiden_hash_bench)->Unit(benchmark::kMillisecond);
 
+// Hashes the pairs of a level of a Merkle tree one at a time
+void poseidon2_hash_pair_bench(State& state) noexcept
+{
+    const size_t num_pairs = static_cast<size_t>(state.range(0));
+    std::vector<fr> inputs(2 * num_pairs);
+    for (auto& input : inputs) {
+        input = fr::random_element();
+    }
+    std::vector<fr> outputs(num_pairs);
+    for (auto _ : state) {
+        for (size_t i = 0; i < num_pairs; ++i) {
+            outputs[i] = bb::crypto::Poseidon2<bb::crypto::Poseidon2Bn254ScalarFieldParams>::hash_pair(
+                inputs[2 * i], inputs[2 * i + 1]);
+        }
+        DoNotOptimize(outputs.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * num_pairs));
+}
+BENCHMARK(poseidon2_hash_pair_bench)->Arg(64)->Arg(1024)->Arg(16384);
+
+// Hashes the pairs of a level of a Merkle tree with the multi-lane permutation
+void poseidon2_hash_pairs_bench(State& state) noexcept
+{
+    const size_t num_pairs = static_cast<size_t>(state.range(0));
+    std::vector<fr> inputs(2 * num_pairs);
+    for (auto& input : inputs) {
+        input = fr::random_element();
+    }
+    std::vector<fr> outputs(num_pairs);
+    for (auto _ : state) {
+        bb::crypto::Poseidon2<bb::crypto::Poseidon2Bn254ScalarFieldParams>::hash_pairs(inputs, outputs);
+        DoNotOptimize(outputs.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * num_pairs));
+}
+BENCHMARK(poseidon2_hash_pairs_bench)->Arg(64)->Arg(1024)->Arg(16384);
+
 BENCHMARK_MAIN();
\ No newline at end of file
@@ -146,6 +146,10 @@ void ClientIVC::accumulate(ClientCircuit& circuit,
                            const std::shared_ptr<MegaVerificationKey>& precomputed_vk,
                            const bool mock_vk)
 {
+    // Keep the memory the previous circuit needed at its peak, and serve the polynomials of this one from it
+    polynomial_arena->reset();
+    PolynomialArena::Scope arena_scope(*polynomial_arena);
+
     // Construct merge proof for the present circuit and add to merge verification queue
     MergeProof merge_proof = goblin.prove_merge(circuit);
 
@@ -292,6 +296,7 @@ void ClientIVC::construct_vk()
  */
 ClientIVC::Proof ClientIVC::prove()
 {
+    PolynomialArena::Scope arena_scope(*polynomial_arena);
     auto [mega_proof, merge_proof] = construct_and_prove_hiding_circuit();
     return { mega_proof, goblin.prove(merge_proof) };
 };
@@ -332,7 +337,8 @@ HonkProof ClientIVC::decider_prove() const
 {
     vinfo("prove decider...");
     fold_output.accumulator->proving_key.commitment_key = bn254_commitment_key;
-    MegaDeciderProver decider_prover(fold_output.accumulator);
+    MegaDeciderProver decider_prover(
+        fold_output.accumulator, std::make_shared<Flavor::Transcript>(), trace_usage_tracker);
     vinfo("finished decider proving.");
     return decider_prover.construct_proof();
 }
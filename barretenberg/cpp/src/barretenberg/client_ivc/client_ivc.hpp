@@ -3,6 +3,7 @@
 #include "barretenberg/goblin/goblin.hpp"
 #include "barretenberg/goblin/mock_circuits.hpp"
 #include "barretenberg/plonk_honk_shared/execution_trace/execution_trace_usage_tracker.hpp"
+#include "barretenberg/polynomials/polynomial_arena.hpp"
 #include "barretenberg/protogalaxy/protogalaxy_prover.hpp"
 #include "barretenberg/protogalaxy/protogalaxy_verifier.hpp"
 #include "barretenberg/stdlib/honk_verifier/decider_recursive_verifier.hpp"
@@ -186,6 +187,9 @@ class ClientIVC {
 
     GoblinProver goblin;
 
+    // Backing memory of the prover polynomials, reused from one accumulated circuit to the next
+    std::shared_ptr<PolynomialArena> polynomial_arena = std::make_shared<PolynomialArena>();
+
     bool initialized = false; // Is the IVC accumulator initialized
 
     ClientIVC(TraceSettings trace_settings = {})
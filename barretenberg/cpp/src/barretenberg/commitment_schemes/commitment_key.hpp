@@ -10,6 +10,7 @@
 #include "barretenberg/common/debug_log.hpp"
 #include "barretenberg/common/op_count.hpp"
 #include "barretenberg/ecc/batched_affine_addition/batched_affine_addition.hpp"
+#include "barretenberg/ecc/scalar_multiplication/bucket_msm.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/ecc/scalar_multiplication/sorted_msm.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
@@ -22,6 +23,7 @@
 
 #include <cstddef>
 #include <memory>
+#include <mutex>
 #include <string_view>
 
 namespace bb {
@@ -43,16 +45,17 @@ template <class Curve> class CommitmentKey {
 
     static size_t get_num_needed_srs_points(size_t num_points)
     {
-        // NOTE 1: Currently we must round up internal space for points as our pippenger algorithm (specifically,
-        // pippenger_unsafe_optimized_for_non_dyadic_polys) will use next power of 2. This is used to simplify the
-        // recursive halving scheme. We do, however allow the polynomial to not be fully formed. Pippenger internally
-        // will pad 0s into the runtime state.
+        // NOTE 1: Commitments no longer need a power-of-2 number of points, but the pippenger runtime state (still used
+        // by IPA) and the ECCVM/IPA code paths assume a dyadic SRS, so we keep rounding up.
         // NOTE 2: We then add one for ECCVM to provide for IPA verification
         return numeric::round_up_power_2(num_points) + EXTRA_SRS_POINTS_FOR_ECCVM_IPA;
     }
 
+    // Only used by the IPA prover, so allocated on first use; `commit` uses the bucket MSM and needs no runtime state
+    std::unique_ptr<scalar_multiplication::pippenger_runtime_state<Curve>> pippenger_runtime_state;
+    std::once_flag pippenger_runtime_state_flag;
+
   public:
-    scalar_multiplication::pippenger_runtime_state<Curve> pippenger_runtime_state;
     std::shared_ptr<srs::factories::CrsFactory<Curve>> crs_factory;
     std::shared_ptr<srs::factories::ProverCrs<Curve>> srs;
     size_t dyadic_size;
@@ -67,19 +70,26 @@ template <class Curve> class CommitmentKey {
      *
      */
     CommitmentKey(const size_t num_points)
-        : pippenger_runtime_state(get_num_needed_srs_points(num_points))
-        , crs_factory(srs::get_crs_factory<Curve>())
+        : crs_factory(srs::get_crs_factory<Curve>())
         , srs(crs_factory->get_prover_crs(get_num_needed_srs_points(num_points)))
         , dyadic_size(get_num_needed_srs_points(num_points))
     {}
 
     // Note: This constructor is to be used only by Plonk; For Honk the srs lives in the CommitmentKey
     CommitmentKey(const size_t num_points, std::shared_ptr<srs::factories::ProverCrs<Curve>> prover_crs)
-        : pippenger_runtime_state(num_points)
-        , srs(prover_crs)
+        : srs(prover_crs)
         , dyadic_size(get_num_needed_srs_points(num_points))
     {}
 
+    scalar_multiplication::pippenger_runtime_state<Curve>& get_pippenger_runtime_state()
+    {
+        std::call_once(pippenger_runtime_state_flag, [this] {
+            pippenger_runtime_state =
+                std::make_unique<scalar_multiplication::pippenger_runtime_state<Curve>>(dyadic_size);
+        });
+        return *pippenger_runtime_state;
+    }
+
     /**
      * @brief Uses the ProverSRS to create a commitment to p(X)
      *
@@ -89,23 +99,10 @@ template <class Curve> class CommitmentKey {
     Commitment commit(PolynomialSpan<const Fr> polynomial)
     {
         PROFILE_THIS_NAME("commit");
-        // We must have a power-of-2 SRS points *after* subtracting by start_index.
-        size_t dyadic_poly_size = numeric::round_up_power_2(polynomial.size());
-        ASSERT(dyadic_poly_size <= dyadic_size && "Polynomial size exceeds commitment key size.");
-        // Because pippenger prefers a power-of-2 size, we must choose a starting index for the points so that we don't
-        // exceed the dyadic_circuit_size. The actual start index of the points will be the smallest it can be so that
-        // the window of points is a power of 2 and still contains the scalars. The best we can do is pick a start index
-        // that ends at the end of the polynomial, which would be polynomial.end_index() - dyadic_poly_size. However,
-        // our polynomial might defined too close to 0, so we set the start_index to 0 in that case.
-        size_t actual_start_index =
-            polynomial.end_index() > dyadic_poly_size ? polynomial.end_index() - dyadic_poly_size : 0;
-        // The relative start index is the offset of the scalars from the start of the points window, i.e.
-        // [actual_start_index, actual_start_index + dyadic_poly_size), so we subtract actual_start_index from the start
-        // index.
-        size_t relative_start_index = polynomial.start_index - actual_start_index;
-        const size_t consumed_srs = actual_start_index + dyadic_poly_size;
+        ASSERT(polynomial.size() <= dyadic_size && "Polynomial size exceeds commitment key size.");
+        // The bucket MSM handles arbitrary sizes and offsets, so we only need the points [0, end_index)
+        const size_t consumed_srs = polynomial.end_index();
         auto srs = srs::get_crs_factory<Curve>()->get_prover_crs(consumed_srs);
-        // We only need the
         if (consumed_srs > srs->get_monomial_size()) {
             throw_or_abort(format("Attempting to commit to a polynomial that needs ",
                                   consumed_srs,
@@ -114,17 +111,42 @@ template <class Curve> class CommitmentKey {
         }
 
         // Extract the precomputed point table (contains raw SRS points at even indices and the corresponding
-        // endomorphism point (\beta*x, -y) at odd indices). We offset by polynomial.start_index * 2 to align
-        // with our polynomial span.
-
-        std::span<G1> point_table = srs->get_monomial_points().subspan(actual_start_index * 2);
+        // endomorphism point (\beta*x, -y) at odd indices). The MSM offsets into it by polynomial.start_index.
+        std::span<const G1> point_table = srs->get_monomial_points();
         DEBUG_LOG_ALL(polynomial.span);
-        Commitment point = scalar_multiplication::pippenger_unsafe_optimized_for_non_dyadic_polys<Curve>(
-            { relative_start_index, polynomial.span }, point_table, pippenger_runtime_state);
+        Commitment point = scalar_multiplication::BucketMSM<Curve>::msm(polynomial, point_table);
         DEBUG_LOG(point);
         return point;
     };
 
+    /**
+     * @brief Commit to several polynomials at once
+     * @details Equivalent to calling `commit` on each polynomial, but the SRS points are streamed through the cache
+     * once for all polynomials and the MSM scratch space and thread fan-out are shared, see BucketMSM::batch_msm.
+     *
+     * @param polynomials
+     * @return std::vector<Commitment> The commitments, in the order of the polynomials
+     */
+    std::vector<Commitment> batch_commit(std::span<const PolynomialSpan<const Fr>> polynomials)
+    {
+        PROFILE_THIS_NAME("batch_commit");
+        size_t consumed_srs = 0;
+        for (const auto& polynomial : polynomials) {
+            ASSERT(polynomial.size() <= dyadic_size && "Polynomial size exceeds commitment key size.");
+            consumed_srs = std::max(consumed_srs, polynomial.end_index());
+        }
+        auto srs = srs::get_crs_factory<Curve>()->get_prover_crs(consumed_srs);
+        if (consumed_srs > srs->get_monomial_size()) {
+            throw_or_abort(format("Attempting to commit to a polynomial that needs ",
+                                  consumed_srs,
+                                  " points with an SRS of size ",
+                                  srs->get_monomial_size()));
+        }
+
+        auto results = scalar_multiplication::BucketMSM<Curve>::batch_msm(polynomials, srs->get_monomial_points());
+        return std::vector<Commitment>(results.begin(), results.end());
+    }
+
     /**
      * @brief Efficiently commit to a sparse polynomial
      * @details Iterate through the {point, scalar} pairs that define the inputs to the commitment MSM, maintain (copy)
@@ -144,7 +166,7 @@ template <class Curve> class CommitmentKey {
         // Extract the precomputed point table (contains raw SRS points at even indices and the corresponding
         // endomorphism point (\beta*x, -y) at odd indices). We offset by polynomial.start_index * 2 to align
         // with our polynomial span.
-        std::span<G1> point_table = srs->get_monomial_points().subspan(polynomial.start_index * 2);
+        std::span<const G1> point_table = srs->get_monomial_points().subspan(polynomial.start_index * 2);
 
         // Define structures needed to multithread the extraction of non-zero inputs
         const size_t num_threads = calculate_num_threads(poly_size);
@@ -190,7 +212,7 @@ template <class Curve> class CommitmentKey {
         }
 
         // Call the version of pippenger which assumes all points are distinct
-        return scalar_multiplication::pippenger_unsafe<Curve>({ 0, scalars }, points, pippenger_runtime_state);
+        return scalar_multiplication::BucketMSM<Curve>::msm({ 0, scalars }, points);
     }
 
     /**
@@ -233,7 +255,7 @@ template <class Curve> class CommitmentKey {
 
         // Extract the precomputed point table (contains raw SRS points at even indices and the corresponding
         // endomorphism point (\beta*x, -y) at odd indices).
-        std::span<G1> point_table = srs->get_monomial_points();
+        std::span<const G1> point_table = srs->get_monomial_points();
 
         std::vector<Fr> scalars;
         scalars.reserve(total_num_scalars);
@@ -253,7 +275,7 @@ template <class Curve> class CommitmentKey {
         }
 
         // Call pippenger
-        return scalar_multiplication::pippenger_unsafe<Curve>({ 0, scalars }, points, pippenger_runtime_state);
+        return scalar_multiplication::BucketMSM<Curve>::msm({ 0, scalars }, points);
     }
 
     /**
@@ -305,7 +327,7 @@ template <class Curve> class CommitmentKey {
 
         // Extract the precomputed point table (contains raw SRS points at even indices and the corresponding
         // endomorphism point (\beta*x, -y) at odd indices).
-        std::span<G1> point_table = srs->get_monomial_points();
+        std::span<const G1> point_table = srs->get_monomial_points();
 
         // Copy the raw SRS points (no endo points) corresponding to the constant regions into contiguous memory
         // TODO(https://github.com/AztecProtocol/barretenberg/issues/1131): Peak memory usage could be improved by
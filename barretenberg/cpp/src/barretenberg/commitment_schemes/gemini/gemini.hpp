@@ -312,6 +312,8 @@ template <typename Curve> class GeminiProver_ {
                                                             std::span<const Fr> multilinear_challenge,
                                                             const Polynomial& A_0);
 
+    static Polynomial compute_fold(const Polynomial& A_l, const Fr& u_l, const size_t n_l);
+
     static std::pair<Polynomial, Polynomial> compute_partially_evaluated_batch_polynomials(
         const size_t log_n,
         PolynomialBatcher& polynomial_batcher,
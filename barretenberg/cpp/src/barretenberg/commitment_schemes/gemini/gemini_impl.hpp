@@ -71,13 +71,20 @@ std::vector<typename GeminiProver_<Curve>::Claim> GeminiProver_<Curve>::prove(
 
     Polynomial A_0 = polynomial_batcher.compute_batched(rho, running_scalar);
 
-    // Construct the d-1 Gemini foldings of A₀(X)
-    std::vector<Polynomial> fold_polynomials = compute_fold_polynomials(log_n, multilinear_challenge, A_0);
-
+    // Construct the d-1 Gemini foldings of A₀(X), committing to each one as soon as it is computed. Only the foldings
+    // are needed once the first one is computed (A₀₊ and A₀₋ are computed from the batcher), so A₀ is released then
+    // rather than kept alive until the end of the PCS.
+    std::vector<Polynomial> fold_polynomials;
+    fold_polynomials.reserve(log_n - 1);
     // TODO(https://github.com/AztecProtocol/barretenberg/issues/1159): Decouple constants from primitives.
     for (size_t l = 0; l < CONST_PROOF_SIZE_LOG_N - 1; l++) {
         std::string label = "Gemini:FOLD_" + std::to_string(l + 1);
         if (l < log_n - 1) {
+            const Polynomial& A_l = l == 0 ? A_0 : fold_polynomials[l - 1];
+            fold_polynomials.emplace_back(compute_fold(A_l, multilinear_challenge[l], size_t{ 1 } << (log_n - l - 1)));
+            if (l == 0) {
+                A_0 = Polynomial();
+            }
             transcript->send_to_verifier(label, commitment_key->commit(fold_polynomials[l]));
         } else {
             transcript->send_to_verifier(label, Commitment::one());
@@ -138,60 +145,64 @@ template <typename Curve>
 std::vector<typename GeminiProver_<Curve>::Polynomial> GeminiProver_<Curve>::compute_fold_polynomials(
     const size_t log_n, std::span<const Fr> multilinear_challenge, const Polynomial& A_0)
 {
-    const size_t num_threads = get_num_cpus_pow2();
-    constexpr size_t efficient_operations_per_thread = 64; // A guess of the number of operation for which there
-                                                           // would be a point in sending them to a separate thread
-
-    // Reserve and allocate space for m-1 Fold polynomials, the foldings of the full batched polynomial A₀
     std::vector<Polynomial> fold_polynomials;
     fold_polynomials.reserve(log_n - 1);
-    for (size_t l = 0; l < log_n - 1; ++l) {
-        // size of the previous polynomial/2
-        const size_t n_l = 1 << (log_n - l - 1);
-
-        // A_l_fold = Aₗ₊₁(X) = (1-uₗ)⋅even(Aₗ)(X) + uₗ⋅odd(Aₗ)(X)
-        fold_polynomials.emplace_back(Polynomial(n_l));
-    }
 
     // A_l = Aₗ(X) is the polynomial being folded
     // in the first iteration, we take the batched polynomial
     // in the next iteration, it is the previously folded one
-    auto A_l = A_0.data();
     for (size_t l = 0; l < log_n - 1; ++l) {
-        // size of the previous polynomial/2
-        const size_t n_l = 1 << (log_n - l - 1);
-
-        // Use as many threads as it is useful so that 1 thread doesn't process 1 element, but make sure that there is
-        // at least 1
-        size_t num_used_threads = std::min(n_l / efficient_operations_per_thread, num_threads);
-        num_used_threads = num_used_threads ? num_used_threads : 1;
-        size_t chunk_size = n_l / num_used_threads;
-        size_t last_chunk_size = (n_l % chunk_size) ? (n_l % num_used_threads) : chunk_size;
-
-        // Opening point is the same for all
-        const Fr u_l = multilinear_challenge[l];
-
-        // A_l_fold = Aₗ₊₁(X) = (1-uₗ)⋅even(Aₗ)(X) + uₗ⋅odd(Aₗ)(X)
-        auto A_l_fold = fold_polynomials[l].data();
-
-        parallel_for(num_used_threads, [&](size_t i) {
-            size_t current_chunk_size = (i == (num_used_threads - 1)) ? last_chunk_size : chunk_size;
-            for (std::ptrdiff_t j = (std::ptrdiff_t)(i * chunk_size);
-                 j < (std::ptrdiff_t)((i * chunk_size) + current_chunk_size);
-                 j++) {
-                // fold(Aₗ)[j] = (1-uₗ)⋅even(Aₗ)[j] + uₗ⋅odd(Aₗ)[j]
-                //            = (1-uₗ)⋅Aₗ[2j]      + uₗ⋅Aₗ[2j+1]
-                //            = Aₗ₊₁[j]
-                A_l_fold[j] = A_l[j << 1] + u_l * (A_l[(j << 1) + 1] - A_l[j << 1]);
-            }
-        });
-        // set Aₗ₊₁ = Aₗ for the next iteration
-        A_l = A_l_fold;
+        const Polynomial& A_l = l == 0 ? A_0 : fold_polynomials[l - 1];
+        fold_polynomials.emplace_back(compute_fold(A_l, multilinear_challenge[l], size_t{ 1 } << (log_n - l - 1)));
     }
 
     return fold_polynomials;
 };
 
+/**
+ * @brief Computes the folding Aₗ₊₁(X) = (1-uₗ)⋅even(Aₗ)(X) + uₗ⋅odd(Aₗ)(X) of a polynomial Aₗ
+ *
+ * @param A_l the polynomial to fold, of size 2⋅n_l
+ * @param u_l the folding challenge
+ * @param n_l size of the folded polynomial
+ * @return Polynomial Aₗ₊₁
+ */
+template <typename Curve>
+typename GeminiProver_<Curve>::Polynomial GeminiProver_<Curve>::compute_fold(const Polynomial& A_l,
+                                                                             const Fr& u_l,
+                                                                             const size_t n_l)
+{
+    const size_t num_threads = get_num_cpus_pow2();
+    constexpr size_t efficient_operations_per_thread = 64; // A guess of the number of operation for which there
+                                                           // would be a point in sending them to a separate thread
+
+    // Use as many threads as it is useful so that 1 thread doesn't process 1 element, but make sure that there is
+    // at least 1
+    size_t num_used_threads = std::min(n_l / efficient_operations_per_thread, num_threads);
+    num_used_threads = num_used_threads ? num_used_threads : 1;
+    size_t chunk_size = n_l / num_used_threads;
+    size_t last_chunk_size = (n_l % chunk_size) ? (n_l % num_used_threads) : chunk_size;
+
+    // Every coefficient is written below
+    Polynomial A_l_fold(n_l, Polynomial::DontZeroMemory::FLAG);
+    const Fr* A_l_data = A_l.data();
+    Fr* A_l_fold_data = A_l_fold.data();
+
+    parallel_for(num_used_threads, [&](size_t i) {
+        size_t current_chunk_size = (i == (num_used_threads - 1)) ? last_chunk_size : chunk_size;
+        for (std::ptrdiff_t j = (std::ptrdiff_t)(i * chunk_size);
+             j < (std::ptrdiff_t)((i * chunk_size) + current_chunk_size);
+             j++) {
+            // fold(Aₗ)[j] = (1-uₗ)⋅even(Aₗ)[j] + uₗ⋅odd(Aₗ)[j]
+            //            = (1-uₗ)⋅Aₗ[2j]      + uₗ⋅Aₗ[2j+1]
+            //            = Aₗ₊₁[j]
+            A_l_fold_data[j] = A_l_data[j << 1] + u_l * (A_l_data[(j << 1) + 1] - A_l_data[j << 1]);
+        }
+    });
+
+    return A_l_fold;
+};
+
 /**
 
  *
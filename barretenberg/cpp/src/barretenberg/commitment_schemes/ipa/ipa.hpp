@@ -172,7 +172,7 @@ template <typename Curve_> class IPA {
         // Set initial vector a to the polynomial monomial coefficients and load vector G
         // Ensure the polynomial copy is fully-formed
         auto a_vec = polynomial.full();
-        std::span<Commitment> srs_elements = ck->srs->get_monomial_points();
+        std::span<const Commitment> srs_elements = ck->srs->get_monomial_points();
         std::vector<Commitment> G_vec_local(poly_length);
 
         if (poly_length * 2 > srs_elements.size()) {
@@ -233,13 +233,13 @@ template <typename Curve_> class IPA {
             // Step 6.a (using letters, because doxygen automatically converts the sublist counters to letters :( )
             // L_i = < a_vec_lo, G_vec_hi > + inner_prod_L * aux_generator
             L_i = bb::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
-                {0, {&a_vec.at(0), /*size*/ round_size}}, {&G_vec_local[round_size], /*size*/ round_size}, ck->pippenger_runtime_state);
+                {0, {&a_vec.at(0), /*size*/ round_size}}, {&G_vec_local[round_size], /*size*/ round_size}, ck->get_pippenger_runtime_state());
             L_i += aux_generator * inner_prod_L;
 
             // Step 6.b
             // R_i = < a_vec_hi, G_vec_lo > + inner_prod_R * aux_generator
             R_i = bb::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
-                {0, {&a_vec.at(round_size), /*size*/ round_size}}, {&G_vec_local[0], /*size*/ round_size}, ck->pippenger_runtime_state);
+                {0, {&a_vec.at(round_size), /*size*/ round_size}}, {&G_vec_local[0], /*size*/ round_size}, ck->get_pippenger_runtime_state());
             R_i += aux_generator * inner_prod_R;
 
             // Step 6.c
@@ -595,6 +595,255 @@ template <typename Curve_> class IPA {
         return reduce_verify_internal_recursive(opening_claim, transcript);
     }
 
+    /**
+     * @brief Compute a single proof opening several polynomials, each at its own evaluation point.
+     *
+     * @details The claims share the auxiliary generator and the round challenges: in each round the prover sends
+     * \f$L_{i-1}\f$ and \f$R_{i-1}\f$ of every claim before receiving \f$u_{i-1}\f$. Each claim is then opened exactly as
+     * in \link IPA::compute_opening_proof_internal compute_opening_proof_internal \endlink, but \f$\vec{G}\f$, whose
+     * folding dominates the cost of the prover, only depends on the challenges and is folded once for all the claims.
+     * Since the proof is only verified natively, it has no dummy rounds.
+     *
+     * @param ck The commitment key containing srs and pippenger_runtime_state for computing MSM
+     * @param opening_claims The polynomials, which must all have the same size, and their opening pairs
+     * @param transcript Prover transcript
+     */
+    static void batch_compute_opening_proof(const std::shared_ptr<CK>& ck,
+                                            const std::vector<ProverOpeningClaim<Curve>>& opening_claims,
+                                            const std::shared_ptr<NativeTranscript>& transcript)
+    {
+        const size_t num_claims = opening_claims.size();
+        ASSERT(num_claims > 0);
+        const size_t poly_length = opening_claims[0].polynomial.size();
+        for (const auto& opening_claim : opening_claims) {
+            ASSERT(opening_claim.polynomial.size() == poly_length && "The batched polynomials should have the same size");
+        }
+
+        // Send polynomial degree + 1 = d to the verifier, and receive the challenge for the auxiliary generator
+        transcript->send_to_verifier("IPA:poly_degree_plus_1", static_cast<uint32_t>(poly_length));
+        const Fr generator_challenge = transcript->template get_challenge<Fr>("IPA:generator_challenge");
+
+        if (generator_challenge.is_zero()) {
+            throw_or_abort("The generator challenge can't be zero");
+        }
+        auto aux_generator = Commitment::one() * generator_challenge;
+
+        ASSERT((poly_length > 0) && (!(poly_length & (poly_length - 1))) &&
+               "The polynomial degree plus 1 should be positive and a power of two");
+        auto log_poly_length = static_cast<size_t>(numeric::get_msb(poly_length));
+        if (log_poly_length > CONST_ECCVM_LOG_N) {
+            throw_or_abort("IPA log_poly_length is too large: " + std::to_string(log_poly_length));
+        }
+
+        // Load vector G, shared by all the claims
+        std::span<const Commitment> srs_elements = ck->srs->get_monomial_points();
+        if (poly_length * 2 > srs_elements.size()) {
+            throw_or_abort("potential bug: Not enough SRS points for IPA!");
+        }
+        std::vector<Commitment> G_vec_local(poly_length);
+        parallel_for_heuristic(
+            poly_length,
+            [&](size_t i) {
+                G_vec_local[i] = srs_elements[i * 2];
+            }, thread_heuristics::FF_COPY_COST);
+
+        // Set each vector a to the coefficients of its polynomial, and each vector b to the powers of its challenge
+        std::vector<Polynomial<Fr>> a_vecs;
+        a_vecs.reserve(num_claims);
+        std::vector<std::vector<Fr>> b_vecs(num_claims, std::vector<Fr>(poly_length));
+        for (size_t claim_idx = 0; claim_idx < num_claims; claim_idx++) {
+            const ProverOpeningClaim<Curve>& opening_claim = opening_claims[claim_idx];
+            a_vecs.emplace_back(opening_claim.polynomial.full());
+            const Fr& challenge = opening_claim.opening_pair.challenge;
+            std::vector<Fr>& b_vec = b_vecs[claim_idx];
+            parallel_for_heuristic(
+                poly_length,
+                [&](size_t start, size_t end, BB_UNUSED size_t chunk_index) {
+                    Fr b_power = challenge.pow(start);
+                    for (size_t i = start; i < end; i++) {
+                        b_vec[i] = b_power;
+                        b_power *= challenge;
+                    }
+                }, thread_heuristics::FF_COPY_COST + thread_heuristics::FF_MULTIPLICATION_COST);
+        }
+
+        GroupElement L_i;
+        GroupElement R_i;
+        std::size_t round_size = poly_length;
+
+        // Perform IPA reduction rounds
+        for (size_t i = 0; i < log_poly_length; i++) {
+            round_size /= 2;
+            std::string index = std::to_string(CONST_ECCVM_LOG_N - i - 1);
+            for (size_t claim_idx = 0; claim_idx < num_claims; claim_idx++) {
+                Polynomial<Fr>& a_vec = a_vecs[claim_idx];
+                const std::vector<Fr>& b_vec = b_vecs[claim_idx];
+                auto inner_prods = parallel_for_heuristic(
+                    round_size,
+                    std::pair{Fr::zero(), Fr::zero()},
+                    [&](size_t j, std::pair<Fr, Fr>& inner_prod_left_right) {
+                        inner_prod_left_right.first += a_vec[j] * b_vec[round_size + j];
+                        inner_prod_left_right.second += a_vec[round_size + j] * b_vec[j];
+                    }, thread_heuristics::FF_ADDITION_COST * 2 + thread_heuristics::FF_MULTIPLICATION_COST * 2);
+                auto [inner_prod_L, inner_prod_R] = sum_pairs(inner_prods);
+                // L_i = < a_vec_lo, G_vec_hi > + inner_prod_L * aux_generator
+                L_i = bb::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
+                    {0, {&a_vec.at(0), /*size*/ round_size}}, {&G_vec_local[round_size], /*size*/ round_size}, ck->get_pippenger_runtime_state());
+                L_i += aux_generator * inner_prod_L;
+                // R_i = < a_vec_hi, G_vec_lo > + inner_prod_R * aux_generator
+                R_i = bb::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
+                    {0, {&a_vec.at(round_size), /*size*/ round_size}}, {&G_vec_local[0], /*size*/ round_size}, ck->get_pippenger_runtime_state());
+                R_i += aux_generator * inner_prod_R;
+
+                std::string claim_index = std::to_string(claim_idx);
+                transcript->send_to_verifier("IPA:L_" + claim_index + "_" + index, Commitment(L_i));
+                transcript->send_to_verifier("IPA:R_" + claim_index + "_" + index, Commitment(R_i));
+            }
+
+            // Receive the challenge shared by all the claims
+            const Fr round_challenge = transcript->template get_challenge<Fr>("IPA:round_challenge_" + index);
+
+            if (round_challenge.is_zero()) {
+                throw_or_abort("IPA round challenge is zero");
+            }
+            const Fr round_challenge_inv = round_challenge.invert();
+
+            // G_vec_new = G_vec_lo + G_vec_hi * round_challenge_inv, once for all the claims
+            auto G_hi_by_inverse_challenge = GroupElement::batch_mul_with_endomorphism(
+                std::span{ G_vec_local.begin() + static_cast<std::ptrdiff_t>(round_size),
+                           G_vec_local.begin() + static_cast<std::ptrdiff_t>(round_size * 2) },
+                round_challenge_inv);
+            GroupElement::batch_affine_add(
+                std::span{ G_vec_local.begin(), G_vec_local.begin() + static_cast<std::ptrdiff_t>(round_size) },
+                G_hi_by_inverse_challenge,
+                G_vec_local);
+
+            // a_vec_new = a_vec_lo + a_vec_hi * round_challenge
+            // b_vec_new = b_vec_lo + b_vec_hi * round_challenge_inv
+            parallel_for_heuristic(
+                round_size,
+                [&](size_t j) {
+                    for (size_t claim_idx = 0; claim_idx < num_claims; claim_idx++) {
+                        a_vecs[claim_idx].at(j) += round_challenge * a_vecs[claim_idx][round_size + j];
+                        b_vecs[claim_idx][j] += round_challenge_inv * b_vecs[claim_idx][round_size + j];
+                    }
+                }, (thread_heuristics::FF_ADDITION_COST * 2 + thread_heuristics::FF_MULTIPLICATION_COST * 2) * num_claims);
+        }
+
+        // Send G_0 and the a_0 of every claim to the verifier
+        transcript->send_to_verifier("IPA:G_0", G_vec_local[0]);
+        for (size_t claim_idx = 0; claim_idx < num_claims; claim_idx++) {
+            transcript->send_to_verifier("IPA:a_0_" + std::to_string(claim_idx), a_vecs[claim_idx][0]);
+        }
+    }
+
+    /**
+     * @brief Natively verify the correctness of a proof computed by \link IPA::batch_compute_opening_proof
+     * batch_compute_opening_proof \endlink
+     *
+     * @details Each claim is checked as in \link IPA::reduce_verify_internal_native reduce_verify_internal_native
+     * \endlink. The vector \f$\vec{s}\f$ only depends on the round challenges, which are shared by the claims, so the MSM
+     * computing \f$G_0=\langle \vec{s},\vec{G}\rangle\f$, which dominates the cost of the verifier, is computed once
+     * for all the claims.
+     *
+     * @param vk Verification_key containing srs and pippenger_runtime_state to be used for MSM
+     * @param opening_claims The commitments and opening pairs, in the order in which they were opened
+     * @param transcript Transcript with elements from the prover and generated challenges
+     *
+     * @return true/false depending on if all the openings verify
+     */
+    static bool batch_reduce_verify(const std::shared_ptr<VK>& vk,
+                                    const std::vector<OpeningClaim<Curve>>& opening_claims,
+                                    const auto& transcript)
+        requires(!Curve::is_stdlib_type)
+    {
+        const size_t num_claims = opening_claims.size();
+        ASSERT(num_claims > 0);
+
+        // Receive polynomial_degree + 1 = d from the prover, and the generator challenge
+        auto poly_length = static_cast<uint32_t>(transcript->template receive_from_prover<typename Curve::BaseField>(
+            "IPA:poly_degree_plus_1"));
+        const Fr generator_challenge = transcript->template get_challenge<Fr>("IPA:generator_challenge");
+
+        if (generator_challenge.is_zero()) {
+            throw_or_abort("The generator challenge can't be zero");
+        }
+        Commitment aux_generator = Commitment::one() * generator_challenge;
+
+        auto log_poly_length = static_cast<size_t>(numeric::get_msb(poly_length));
+        if (log_poly_length > CONST_ECCVM_LOG_N) {
+            throw_or_abort("IPA log_poly_length is too large " + std::to_string(log_poly_length));
+        }
+
+        // Receive the L_i and R_i of every claim and the shared round challenges
+        auto pippenger_size = 2 * log_poly_length;
+        std::vector<Fr> round_challenges(log_poly_length);
+        std::vector<std::vector<Commitment>> msm_elements(num_claims, std::vector<Commitment>(pippenger_size));
+        for (size_t i = 0; i < log_poly_length; i++) {
+            std::string index = std::to_string(CONST_ECCVM_LOG_N - i - 1);
+            for (size_t claim_idx = 0; claim_idx < num_claims; claim_idx++) {
+                std::string claim_index = std::to_string(claim_idx);
+                msm_elements[claim_idx][2 * i] =
+                    transcript->template receive_from_prover<Commitment>("IPA:L_" + claim_index + "_" + index);
+                msm_elements[claim_idx][2 * i + 1] =
+                    transcript->template receive_from_prover<Commitment>("IPA:R_" + claim_index + "_" + index);
+            }
+            round_challenges[i] = transcript->template get_challenge<Fr>("IPA:round_challenge_" + index);
+            if (round_challenges[i].is_zero()) {
+                throw_or_abort("Round challenges can't be zero");
+            }
+        }
+        std::vector<Fr> round_challenges_inv = round_challenges;
+        Fr::batch_invert(round_challenges_inv);
+        std::vector<Fr> msm_scalars(pippenger_size);
+        for (size_t i = 0; i < log_poly_length; i++) {
+            msm_scalars[2 * i] = round_challenges_inv[i];
+            msm_scalars[2 * i + 1] = round_challenges[i];
+        }
+
+        // Compute G₀ = ⟨s, G⟩ once for all the claims
+        Polynomial<Fr> s_poly(construct_poly_from_u_challenges_inv(log_poly_length, round_challenges_inv));
+
+        std::span<const Commitment> srs_elements = vk->get_monomial_points();
+        if (poly_length * 2 > srs_elements.size()) {
+            throw_or_abort("potential bug: Not enough SRS points for IPA!");
+        }
+        std::vector<Commitment> G_vec_local(poly_length);
+        parallel_for_heuristic(
+            poly_length,
+            [&](size_t i) {
+                G_vec_local[i] = srs_elements[i * 2];
+            }, thread_heuristics::FF_COPY_COST * 2);
+
+        Commitment G_zero = bb::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
+           s_poly, {&G_vec_local[0], /*size*/ poly_length}, vk->pippenger_runtime_state);
+        Commitment G_zero_sent = transcript->template receive_from_prover<Commitment>("IPA:G_0");
+        ASSERT(G_zero == G_zero_sent && "G_0 should be equal to G_0 sent in transcript.");
+
+        bool verified = true;
+        for (size_t claim_idx = 0; claim_idx < num_claims; claim_idx++) {
+            const OpeningClaim<Curve>& opening_claim = opening_claims[claim_idx];
+            // C₀ = C + f(\beta) ⋅ U + ∑_{j ∈ [k]} u_j^{-1}L_j + ∑_{j ∈ [k]} u_jR_j
+            GroupElement C_prime = opening_claim.commitment + (aux_generator * opening_claim.opening_pair.evaluation);
+            GroupElement LR_sums = bb::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
+                {0, {&msm_scalars[0], /*size*/ pippenger_size}}, {&msm_elements[claim_idx][0], /*size*/ pippenger_size}, vk->pippenger_runtime_state);
+            GroupElement C_zero = C_prime + LR_sums;
+
+            // b_zero = g(evaluation) = ∏_{i ∈ [k]} (1 + u_{i-1}^{-1}. (evaluation)^{2^{i-1}})
+            Fr b_zero = Fr::one();
+            for (size_t i = 0; i < log_poly_length; i++) {
+                b_zero *= Fr::one() + (round_challenges_inv[log_poly_length - 1 - i] *
+                                       opening_claim.opening_pair.challenge.pow(1 << i));
+            }
+
+            // Check that C₀ = a₀ ⋅ G₀ + a₀ ⋅ b₀ ⋅ U
+            auto a_zero = transcript->template receive_from_prover<Fr>("IPA:a_0_" + std::to_string(claim_idx));
+            GroupElement right_hand_side = G_zero * a_zero + aux_generator * a_zero * b_zero;
+            verified = verified && (C_zero.normalize() == right_hand_side.normalize());
+        }
+        return verified;
+    }
+
     /**
      * @brief  Fully recursively verify the correctness of an IPA proof, including computing G_zero. Unlike native verification, there is no
      * parallelisation in this function as our circuit construction does not currently support parallelisation.
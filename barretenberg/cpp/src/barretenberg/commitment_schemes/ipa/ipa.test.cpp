@@ -242,6 +242,50 @@ TEST_F(IPATest, Open)
     EXPECT_EQ(prover_transcript->get_manifest(), verifier_transcript->get_manifest());
 }
 
+TEST_F(IPATest, BatchOpen)
+{
+    // open several polynomials, each at its own point, with a single proof
+    std::vector<ProverOpeningClaim<Curve>> prover_claims;
+    std::vector<OpeningClaim<Curve>> opening_claims;
+    for (size_t i = 0; i < 3; i++) {
+        auto poly = Polynomial::random(n);
+        auto [x, eval] = this->random_eval(poly);
+        auto commitment = ck->commit(poly);
+        opening_claims.push_back({ { x, eval }, commitment });
+        prover_claims.push_back({ std::move(poly), { x, eval } });
+    }
+
+    auto prover_transcript = std::make_shared<NativeTranscript>();
+    PCS::batch_compute_opening_proof(ck, prover_claims, prover_transcript);
+
+    auto verifier_transcript = std::make_shared<NativeTranscript>(prover_transcript->proof_data);
+    EXPECT_TRUE(PCS::batch_reduce_verify(vk, opening_claims, verifier_transcript));
+
+    EXPECT_EQ(prover_transcript->get_manifest(), verifier_transcript->get_manifest());
+}
+
+TEST_F(IPATest, BatchOpenFailsOnWrongEvaluation)
+{
+    std::vector<ProverOpeningClaim<Curve>> prover_claims;
+    std::vector<OpeningClaim<Curve>> opening_claims;
+    for (size_t i = 0; i < 2; i++) {
+        auto poly = Polynomial::random(n);
+        auto [x, eval] = this->random_eval(poly);
+        auto commitment = ck->commit(poly);
+        opening_claims.push_back({ { x, eval }, commitment });
+        prover_claims.push_back({ std::move(poly), { x, eval } });
+    }
+    // a wrong evaluation of the second claim is caught even though the first one is correct
+    prover_claims[1].opening_pair.evaluation += Fr::one();
+    opening_claims[1].opening_pair.evaluation += Fr::one();
+
+    auto prover_transcript = std::make_shared<NativeTranscript>();
+    PCS::batch_compute_opening_proof(ck, prover_claims, prover_transcript);
+
+    auto verifier_transcript = std::make_shared<NativeTranscript>(prover_transcript->proof_data);
+    EXPECT_FALSE(PCS::batch_reduce_verify(vk, opening_claims, verifier_transcript));
+}
+
 TEST_F(IPATest, GeminiShplonkIPAWithShift)
 {
     // Generate multilinear polynomials, their commitments (genuine and mocked) and evaluations (genuine) at a random
@@ -178,6 +178,34 @@ TYPED_TEST(CommitmentKeyTest, CommitSRSCheck)
     EXPECT_EQ(commit_result, full_commit_result);
 }
 
+// Check that batch_commit returns the same results as committing to each polynomial individually
+TYPED_TEST(CommitmentKeyTest, BatchCommit)
+{
+    using Curve = TypeParam;
+    using CK = CommitmentKey<Curve>;
+    using G1 = Curve::AffineElement;
+    using Fr = Curve::ScalarField;
+    using Polynomial = bb::Polynomial<Fr>;
+
+    const size_t num_points = 1 << 12; // large enough to ensure normal pippenger logic is used
+
+    // Polynomials with different sizes and start indices
+    std::vector<Polynomial> polys;
+    polys.emplace_back(Polynomial::random(num_points));
+    polys.emplace_back(Polynomial::random(num_points - 1000, num_points, 1000));
+    polys.emplace_back(Polynomial::random(50, num_points, 3));
+    polys.emplace_back(num_points);
+
+    auto key = TestFixture::template create_commitment_key<CK>(num_points);
+    std::vector<PolynomialSpan<const Fr>> spans(polys.begin(), polys.end());
+    std::vector<G1> batch_result = key->batch_commit(spans);
+
+    ASSERT_EQ(batch_result.size(), polys.size());
+    for (size_t i = 0; i < polys.size(); ++i) {
+        EXPECT_EQ(batch_result[i], key->commit(polys[i]));
+    }
+}
+
 // Check that commit and commit_sparse return the same result for a random sparse polynomial
 TYPED_TEST(CommitmentKeyTest, CommitSparse)
 {
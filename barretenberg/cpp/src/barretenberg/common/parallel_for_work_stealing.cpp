@@ -0,0 +1,328 @@
+#ifndef NO_MULTITHREADING
+#include "barretenberg/common/compiler_hints.hpp"
+#include "thread.hpp"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief The shared state of a single parallel_for invocation.
+ * @details Lives on the stack of the thread that called parallel_for. That thread does not return until the thread
+ * finishing the last task has set `done` (under `mutex`), so every task referencing a Job is guaranteed to finish
+ * before the Job goes out of scope.
+ */
+struct Job {
+    const std::function<void(size_t)>* func;
+    std::atomic<size_t> remaining;
+    std::mutex mutex;
+    std::condition_variable done_condition;
+    bool done = false;
+    std::exception_ptr exception;
+};
+
+/**
+ * @brief A contiguous range of iterations of a Job. Ranges are split in half lazily when they are executed, so a
+ * single parallel_for only ever pushes O(log(n)) tasks per thread and idle threads steal large chunks.
+ */
+struct Task {
+    Job* job;
+    size_t begin;
+    size_t end;
+};
+
+struct WorkerQueue {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+};
+
+class WorkStealingScheduler {
+  public:
+    // The largest number of workers the scheduler can run, whatever the requested concurrency
+    static constexpr size_t MIN_CAPACITY = 256;
+
+    WorkStealingScheduler();
+    WorkStealingScheduler(const WorkStealingScheduler& other) = delete;
+    WorkStealingScheduler(WorkStealingScheduler&& other) = delete;
+    ~WorkStealingScheduler();
+
+    WorkStealingScheduler& operator=(const WorkStealingScheduler& other) = delete;
+    WorkStealingScheduler& operator=(WorkStealingScheduler&& other) = delete;
+
+    void run(size_t num_iterations, const std::function<void(size_t)>& func);
+
+  private:
+    // Queue index of the current thread. Threads outside of the pool (e.g. the main thread) share the last queue.
+    static thread_local size_t queue_index_;
+    static thread_local const WorkStealingScheduler* owner_;
+
+    const size_t capacity;
+    // One queue per possible worker plus one shared queue for external threads, allocated upfront so that workers
+    // can be added while other threads look for tasks
+    std::vector<std::unique_ptr<WorkerQueue>> queues;
+    std::vector<std::thread> workers;
+    std::mutex workers_mutex;
+    std::atomic<size_t> num_workers = 0;
+    // Workers with an index at or above this are parked
+    std::atomic<size_t> num_active_workers = 0;
+    std::atomic<size_t> num_queued_tasks = 0;
+    std::atomic<size_t> num_sleeping_workers = 0;
+    std::mutex sleep_mutex;
+    std::condition_variable condition;
+    std::condition_variable park_condition;
+    bool stop = false;
+
+    BB_NO_PROFILE void worker_loop(size_t thread_index);
+
+    void set_num_active_workers(size_t num_active);
+    size_t external_queue() const { return capacity; }
+    size_t current_queue() const { return owner_ == this ? queue_index_ : external_queue(); }
+    // The queue at a position in [0, num_workers], the last position being the external queue
+    size_t queue_at(size_t position, size_t workers) const { return position == workers ? external_queue() : position; }
+    size_t position_of(size_t queue_index, size_t workers) const
+    {
+        return queue_index == external_queue() ? workers : queue_index;
+    }
+    void push(size_t queue_index, const Task& task);
+    std::optional<Task> take(size_t queue_index, const Job* job, bool from_back);
+    std::optional<Task> find_task(size_t queue_index, const Job* job = nullptr);
+    void execute(size_t queue_index, Task task);
+};
+
+thread_local size_t WorkStealingScheduler::queue_index_ = 0;
+thread_local const WorkStealingScheduler* WorkStealingScheduler::owner_ = nullptr;
+
+WorkStealingScheduler::WorkStealingScheduler()
+    : capacity(std::max<size_t>(MIN_CAPACITY, std::thread::hardware_concurrency()))
+{
+    queues.reserve(capacity + 1);
+    for (size_t i = 0; i < capacity + 1; ++i) {
+        queues.emplace_back(std::make_unique<WorkerQueue>());
+    }
+    workers.reserve(capacity);
+}
+
+WorkStealingScheduler::~WorkStealingScheduler()
+{
+    {
+        std::unique_lock<std::mutex> lock(sleep_mutex);
+        stop = true;
+    }
+    condition.notify_all();
+    park_condition.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+/**
+ * @brief Spawns or parks workers so that num_active of them run tasks
+ * @details Workers are never destroyed: lowering the concurrency parks the workers with the highest indices, which
+ * first finish the tasks they hold.
+ */
+void WorkStealingScheduler::set_num_active_workers(size_t num_active)
+{
+    num_active = std::min(num_active, capacity);
+    if (num_active_workers.load(std::memory_order_acquire) == num_active) {
+        return;
+    }
+    std::unique_lock<std::mutex> workers_lock(workers_mutex);
+    while (workers.size() < num_active) {
+        workers.emplace_back(&WorkStealingScheduler::worker_loop, this, workers.size());
+        num_workers.store(workers.size(), std::memory_order_release);
+    }
+    {
+        std::unique_lock<std::mutex> lock(sleep_mutex);
+        num_active_workers.store(num_active, std::memory_order_seq_cst);
+    }
+    condition.notify_all();
+    park_condition.notify_all();
+}
+
+void WorkStealingScheduler::push(size_t queue_index, const Task& task)
+{
+    {
+        std::unique_lock<std::mutex> lock(queues[queue_index]->mutex);
+        queues[queue_index]->tasks.push_back(task);
+    }
+    num_queued_tasks.fetch_add(1, std::memory_order_seq_cst);
+    // A worker going to sleep increments num_sleeping_workers before checking num_queued_tasks, and we increment
+    // num_queued_tasks before checking num_sleeping_workers, so at least one of us sees the other. Taking the lock
+    // ensures that a worker seen as sleeping is waiting before we notify it.
+    if (num_sleeping_workers.load(std::memory_order_seq_cst) != 0) {
+        { std::unique_lock<std::mutex> lock(sleep_mutex); }
+        condition.notify_one();
+    }
+}
+
+/**
+ * @brief Takes a task from a queue, from the back (the owner: most recently split, smallest and hottest in cache) or
+ * from the front (thieves: oldest and largest remaining range). If job is set, only takes a task of that job.
+ */
+std::optional<Task> WorkStealingScheduler::take(size_t queue_index, const Job* job, bool from_back)
+{
+    auto& queue = *queues[queue_index];
+    std::unique_lock<std::mutex> lock(queue.mutex, std::defer_lock);
+    if (from_back) {
+        lock.lock();
+    } else if (!lock.try_lock()) {
+        return std::nullopt;
+    }
+    auto& tasks = queue.tasks;
+    const auto matches = [job](const Task& task) { return job == nullptr || task.job == job; };
+    std::optional<Task> result;
+    if (from_back) {
+        const auto it = std::find_if(tasks.rbegin(), tasks.rend(), matches);
+        if (it != tasks.rend()) {
+            result = *it;
+            tasks.erase(std::next(it).base());
+        }
+    } else {
+        const auto it = std::find_if(tasks.begin(), tasks.end(), matches);
+        if (it != tasks.end()) {
+            result = *it;
+            tasks.erase(it);
+        }
+    }
+    if (result.has_value()) {
+        num_queued_tasks.fetch_sub(1, std::memory_order_seq_cst);
+    }
+    return result;
+}
+
+std::optional<Task> WorkStealingScheduler::find_task(size_t queue_index, const Job* job)
+{
+    if (auto task = take(queue_index, job, /*from_back=*/true)) {
+        return task;
+    }
+    const size_t workers = num_workers.load(std::memory_order_acquire);
+    const size_t num_positions = workers + 1;
+    const size_t position = position_of(queue_index, workers);
+    for (size_t offset = 1; offset < num_positions; ++offset) {
+        if (auto task = take(queue_at((position + offset) % num_positions, workers), job, /*from_back=*/false)) {
+            return task;
+        }
+    }
+    return std::nullopt;
+}
+
+void WorkStealingScheduler::execute(size_t queue_index, Task task)
+{
+    // Keep half of the range available to thieves until a single iteration is left.
+    while (task.end - task.begin > 1) {
+        const size_t mid = task.begin + (task.end - task.begin) / 2;
+        push(queue_index, Task{ task.job, mid, task.end });
+        task.end = mid;
+    }
+    Job& job = *task.job;
+#ifndef __wasm__
+    // An exception must not unwind past a Job that other threads still reference, so hand it to the job's owner.
+    try {
+        (*job.func)(task.begin);
+    } catch (...) {
+        std::unique_lock<std::mutex> lock(job.mutex);
+        if (!job.exception) {
+            job.exception = std::current_exception();
+        }
+    }
+#else
+    (*job.func)(task.begin);
+#endif
+    if (job.remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        // The owner only returns once it has seen `done` under the lock, so the job stays alive until we unlock.
+        std::unique_lock<std::mutex> lock(job.mutex);
+        job.done = true;
+        job.done_condition.notify_one();
+    }
+}
+
+void WorkStealingScheduler::run(size_t num_iterations, const std::function<void(size_t)>& func)
+{
+    if (num_iterations == 0) {
+        return;
+    }
+    set_num_active_workers(bb::get_num_cpus() - 1);
+    Job job{ &func, num_iterations, {}, {}, false, {} };
+    const size_t queue_index = current_queue();
+    execute(queue_index, Task{ &job, 0, num_iterations });
+
+    // Help with the tasks of our own job only. Running another caller's task here could make this thread wait on
+    // locks (e.g. database transactions) held by its caller, and the caller of a task is not blocked by us.
+    while (job.remaining.load(std::memory_order_acquire) != 0) {
+        auto task = find_task(queue_index, &job);
+        if (!task) {
+            break;
+        }
+        execute(queue_index, *task);
+    }
+    // The remaining tasks are running on other threads: wait for them to finish.
+    {
+        std::unique_lock<std::mutex> lock(job.mutex);
+        job.done_condition.wait(lock, [&job] { return job.done; });
+    }
+#ifndef __wasm__
+    if (job.exception) {
+        std::rethrow_exception(job.exception);
+    }
+#endif
+}
+
+void WorkStealingScheduler::worker_loop(size_t thread_index)
+{
+    owner_ = this;
+    queue_index_ = thread_index;
+    while (true) {
+        if (thread_index >= num_active_workers.load(std::memory_order_seq_cst)) {
+            std::unique_lock<std::mutex> lock(sleep_mutex);
+            // We may have been woken up instead of an active worker: pass the notification on.
+            condition.notify_one();
+            park_condition.wait(lock, [&] { return thread_index < num_active_workers.load() || stop; });
+            if (stop) {
+                break;
+            }
+            continue;
+        }
+        if (auto task = find_task(thread_index)) {
+            execute(thread_index, *task);
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(sleep_mutex);
+        num_sleeping_workers.fetch_add(1, std::memory_order_seq_cst);
+        condition.wait(lock, [&] {
+            return num_queued_tasks.load(std::memory_order_seq_cst) != 0 || stop ||
+                   thread_index >= num_active_workers.load();
+        });
+        num_sleeping_workers.fetch_sub(1, std::memory_order_seq_cst);
+        if (stop) {
+            break;
+        }
+    }
+}
+} // namespace
+
+namespace bb {
+/**
+ * A persistent pool where every worker owns a deque of iteration ranges. A thread executing a range keeps splitting
+ * it in half, pushing the upper half onto its own deque, until a single iteration remains. Idle workers steal the
+ * oldest (largest) range from the front of another worker's deque.
+ * The calling thread executes the tasks of its own job while there are some left, then blocks until the tasks taken
+ * by other threads are done. This makes nested parallel_for calls (e.g. a parallel commitment inside a parallel
+ * sumcheck) safe, and lets the inner loop's iterations be picked up by whichever workers are idle at the tail of the
+ * outer loop. The number of workers follows get_num_cpus() on every call.
+ */
+void parallel_for_work_stealing(size_t num_iterations, const std::function<void(size_t)>& func)
+{
+    static WorkStealingScheduler scheduler;
+    scheduler.run(num_iterations, func);
+}
+} // namespace bb
+#endif
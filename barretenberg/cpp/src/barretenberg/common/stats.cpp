@@ -0,0 +1,190 @@
+#include "barretenberg/common/stats.hpp"
+#include "barretenberg/common/thread.hpp"
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+#ifndef __wasm__
+#include <sys/resource.h>
+#endif
+
+namespace bb::stats {
+
+namespace {
+std::string escape_json(const std::string& str)
+{
+    std::string result;
+    result.reserve(str.size());
+    for (char c : str) {
+        if (c == '"' || c == '\\') {
+            result += '\\';
+        }
+        result += c;
+    }
+    return result;
+}
+} // namespace
+
+double utilization(uint64_t wall_ns, uint64_t busy_ns, size_t num_threads)
+{
+    if (wall_ns == 0 || num_threads == 0) {
+        return 0;
+    }
+    const double capacity_ns = static_cast<double>(wall_ns) * static_cast<double>(num_threads);
+    return std::min(1.0, static_cast<double>(busy_ns) / capacity_ns);
+}
+
+Counter::Counter(const char* name, Kind kind)
+    : name_(name)
+    , kind_(kind)
+{
+    Stats::get().register_counter(*this);
+}
+
+Phase::Phase(const char* name)
+    : name_(name)
+{
+    Stats::get().register_phase(*this);
+}
+
+Stats& Stats::get()
+{
+    static Stats stats;
+    return stats;
+}
+
+template <typename T> void Stats::push(std::atomic<T*>& head, T& item)
+{
+    T* current = head.load(std::memory_order_relaxed);
+    do {
+        item.next_ = current;
+    } while (!head.compare_exchange_weak(current, &item, std::memory_order_release, std::memory_order_relaxed));
+}
+
+void Stats::register_counter(Counter& counter)
+{
+    push(counters, counter);
+}
+
+void Stats::register_phase(Phase& phase)
+{
+    push(phases, phase);
+}
+
+void Stats::reset()
+{
+    for (Counter* counter = counters.load(std::memory_order_acquire); counter != nullptr; counter = counter->next_) {
+        counter->value_.store(0, std::memory_order_relaxed);
+    }
+    for (Phase* phase = phases.load(std::memory_order_acquire); phase != nullptr; phase = phase->next_) {
+        phase->count_.store(0, std::memory_order_relaxed);
+        phase->wall_ns_.store(0, std::memory_order_relaxed);
+        phase->max_wall_ns_.store(0, std::memory_order_relaxed);
+        phase->busy_ns_.store(0, std::memory_order_relaxed);
+    }
+}
+
+std::map<std::string, PhaseStats> Stats::get_phases() const
+{
+    std::map<std::string, PhaseStats> result;
+    for (Phase* phase = phases.load(std::memory_order_acquire); phase != nullptr; phase = phase->next_) {
+        const uint64_t count = phase->count_.load(std::memory_order_relaxed);
+        if (count == 0) {
+            continue;
+        }
+        PhaseStats& stats = result[phase->name_];
+        stats.count += count;
+        stats.wall_ns += phase->wall_ns_.load(std::memory_order_relaxed);
+        stats.max_wall_ns = std::max(stats.max_wall_ns, phase->max_wall_ns_.load(std::memory_order_relaxed));
+        stats.busy_ns += phase->busy_ns_.load(std::memory_order_relaxed);
+    }
+    return result;
+}
+
+std::map<std::string, uint64_t> Stats::get_counters() const
+{
+    std::map<std::string, uint64_t> result;
+    for (Counter* counter = counters.load(std::memory_order_acquire); counter != nullptr; counter = counter->next_) {
+        const uint64_t value = counter->value_.load(std::memory_order_relaxed);
+        if (value == 0) {
+            continue;
+        }
+        uint64_t& merged = result[counter->name_];
+        merged = counter->kind_ == Counter::Kind::SUM ? merged + value : std::max(merged, value);
+    }
+    return result;
+}
+
+std::string Stats::to_json() const
+{
+    constexpr double NS_PER_MS = 1e6;
+
+    std::ostringstream os;
+    os << std::fixed << std::setprecision(3);
+    const size_t num_threads = get_num_cpus();
+    os << "{\"num_threads\":" << num_threads << ",\"peak_rss_bytes\":" << peak_rss_bytes() << ",\"phases\":{";
+    bool first = true;
+    for (const auto& [name, phase] : get_phases()) {
+        os << (first ? "" : ",") << "\"" << escape_json(name) << "\":{\"count\":" << phase.count
+           << ",\"wall_ms\":" << static_cast<double>(phase.wall_ns) / NS_PER_MS
+           << ",\"max_wall_ms\":" << static_cast<double>(phase.max_wall_ns) / NS_PER_MS
+           << ",\"utilization\":" << utilization(phase.wall_ns, phase.busy_ns, num_threads) << "}";
+        first = false;
+    }
+    os << "},\"counters\":{";
+    first = true;
+    for (const auto& [key, value] : get_counters()) {
+        os << (first ? "" : ",") << "\"" << escape_json(key) << "\":" << value;
+        first = false;
+    }
+    os << "}}";
+    return os.str();
+}
+
+ScopedBusyTimer::ScopedBusyTimer()
+    : start(std::chrono::steady_clock::now())
+{
+    ThreadContext& context = get_thread_context();
+    previous_busy_ns = context.busy_ns;
+    previous_waiting_ns = context.waiting_ns;
+    context.busy_ns = &busy_ns;
+    context.waiting_ns = &waiting_ns;
+}
+
+ScopedBusyTimer::Times ScopedBusyTimer::stop()
+{
+    if (stopped) {
+        return times;
+    }
+    stopped = true;
+    times.wall_ns = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+    // parallel_for has returned, so its iterations have added their busy time
+    times.busy_ns = busy_ns.load(std::memory_order_relaxed) + times.wall_ns - waiting_ns;
+
+    ThreadContext& context = get_thread_context();
+    context.busy_ns = previous_busy_ns;
+    context.waiting_ns = previous_waiting_ns;
+    if (previous_busy_ns != nullptr) {
+        *previous_waiting_ns += times.wall_ns;
+        previous_busy_ns->fetch_add(times.busy_ns, std::memory_order_relaxed);
+    }
+    return times;
+}
+
+uint64_t peak_rss_bytes()
+{
+#ifndef __wasm__
+    struct rusage usage {};
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+#ifdef __APPLE__
+        // Reported in bytes on macOS, and in kilobytes elsewhere
+        return static_cast<uint64_t>(usage.ru_maxrss);
+#else
+        return static_cast<uint64_t>(usage.ru_maxrss) * 1024;
+#endif
+    }
+#endif
+    return 0;
+}
+
+} // namespace bb::stats
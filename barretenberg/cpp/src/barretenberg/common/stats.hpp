@@ -0,0 +1,216 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+
+/**
+ * Always-on, low overhead statistics of a process: the wall time and thread utilization of coarse phases (e.g.
+ * sumcheck), sizes and counts of operations (e.g. MSMs), and the peak memory usage. Unlike the op counts and Tracy
+ * zones of op_count.hpp this does not need a special build. Each statistic is a static registered on first use, so
+ * recording it costs a few relaxed atomic operations: no lock and no lookup by name. Timing the thread utilization
+ * costs two clock reads per parallel_for iteration inside a phase.
+ *
+ * The statistics can be exported as JSON, e.g. with `bb prove --stats-out`. The utilization of a phase is its busy
+ * time over its wall time times the number of threads.
+ */
+namespace bb::stats {
+
+struct PhaseStats {
+    uint64_t count = 0;
+    uint64_t wall_ns = 0;
+    uint64_t max_wall_ns = 0;
+    // Time threads spent working for the phase, see ScopedBusyTimer
+    uint64_t busy_ns = 0;
+};
+
+/**
+ * @brief Share of the time of num_threads threads spent busy over a wall time, in [0, 1]
+ */
+double utilization(uint64_t wall_ns, uint64_t busy_ns, size_t num_threads);
+
+// Raises an atomic to value if it is lower
+inline void fetch_max(std::atomic<uint64_t>& target, uint64_t value)
+{
+    uint64_t current = target.load(std::memory_order_relaxed);
+    while (current < value && !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+
+/**
+ * @brief A named count or maximum, e.g. the number of MSMs
+ * @details Must have static storage duration: it is never unregistered.
+ */
+class Counter {
+  public:
+    enum class Kind { SUM, MAX };
+
+    Counter(const char* name, Kind kind);
+    Counter(const Counter&) = delete;
+    Counter(Counter&&) = delete;
+    Counter& operator=(const Counter&) = delete;
+    Counter& operator=(Counter&&) = delete;
+    ~Counter() = default;
+
+    void add(uint64_t value) { value_.fetch_add(value, std::memory_order_relaxed); }
+    void record_max(uint64_t value) { fetch_max(value_, value); }
+
+  private:
+    friend class Stats;
+    const char* name_;
+    Kind kind_;
+    std::atomic<uint64_t> value_ = 0;
+    Counter* next_ = nullptr;
+};
+
+/**
+ * @brief The number of runs, wall time and busy time of a named phase, e.g. sumcheck
+ * @details Must have static storage duration: it is never unregistered.
+ */
+class Phase {
+  public:
+    explicit Phase(const char* name);
+    Phase(const Phase&) = delete;
+    Phase(Phase&&) = delete;
+    Phase& operator=(const Phase&) = delete;
+    Phase& operator=(Phase&&) = delete;
+    ~Phase() = default;
+
+    void record(uint64_t wall_ns, uint64_t busy_ns)
+    {
+        count_.fetch_add(1, std::memory_order_relaxed);
+        wall_ns_.fetch_add(wall_ns, std::memory_order_relaxed);
+        fetch_max(max_wall_ns_, wall_ns);
+        busy_ns_.fetch_add(busy_ns, std::memory_order_relaxed);
+    }
+
+  private:
+    friend class Stats;
+    const char* name_;
+    std::atomic<uint64_t> count_ = 0;
+    std::atomic<uint64_t> wall_ns_ = 0;
+    std::atomic<uint64_t> max_wall_ns_ = 0;
+    std::atomic<uint64_t> busy_ns_ = 0;
+    Phase* next_ = nullptr;
+};
+
+/**
+ * @brief The registry of every counter and phase of the process
+ * @details Statistics with the same name (e.g. a phase in a template instantiated for several flavors) are merged
+ * when read.
+ */
+class Stats {
+  public:
+    static Stats& get();
+
+    // Zeroes every statistic
+    void reset();
+
+    std::map<std::string, PhaseStats> get_phases() const;
+    std::map<std::string, uint64_t> get_counters() const;
+
+    std::string to_json() const;
+
+  private:
+    friend class Counter;
+    friend class Phase;
+
+    Stats() = default;
+
+    // Statistics are kept in lock free lists that are only ever added to
+    template <typename T> static void push(std::atomic<T*>& head, T& item);
+    void register_counter(Counter& counter);
+    void register_phase(Phase& phase);
+
+    std::atomic<Counter*> counters{ nullptr };
+    std::atomic<Phase*> phases{ nullptr };
+};
+
+// Maximum resident set size of the process so far
+uint64_t peak_rss_bytes();
+
+/**
+ * @brief Measures the wall time of the enclosing scope and the time threads spend working for it
+ * @details The busy time is the time the thread spends in the scope, less the time it waits for a parallel_for, plus
+ * the time the threads running the iterations of those parallel_for spend in them (less their own waits). Timers nest:
+ * an inner timer counts as busy time of the one enclosing it only through its own busy time. Threads other than
+ * parallel_for workers (e.g. a ThreadPool) are not seen.
+ */
+class ScopedBusyTimer {
+  public:
+    struct Times {
+        uint64_t wall_ns = 0;
+        uint64_t busy_ns = 0;
+    };
+
+    ScopedBusyTimer();
+    ~ScopedBusyTimer() { stop(); }
+    ScopedBusyTimer(const ScopedBusyTimer&) = delete;
+    ScopedBusyTimer(ScopedBusyTimer&&) = delete;
+    ScopedBusyTimer& operator=(const ScopedBusyTimer&) = delete;
+    ScopedBusyTimer& operator=(ScopedBusyTimer&&) = delete;
+
+    // Ends the measurement on the first call, and returns it
+    Times stop();
+
+  private:
+    std::chrono::steady_clock::time_point start;
+    std::atomic<uint64_t> busy_ns = 0;
+    uint64_t waiting_ns = 0;
+    std::atomic<uint64_t>* previous_busy_ns;
+    uint64_t* previous_waiting_ns;
+    bool stopped = false;
+    Times times;
+};
+
+/**
+ * @brief Records the wall time and busy time of the enclosing scope in a phase
+ */
+class ScopedPhase {
+  public:
+    explicit ScopedPhase(Phase& phase)
+        : phase(phase)
+    {}
+    ~ScopedPhase()
+    {
+        const ScopedBusyTimer::Times times = timer.stop();
+        phase.record(times.wall_ns, times.busy_ns);
+    }
+    ScopedPhase(const ScopedPhase&) = delete;
+    ScopedPhase(ScopedPhase&&) = delete;
+    ScopedPhase& operator=(const ScopedPhase&) = delete;
+    ScopedPhase& operator=(ScopedPhase&&) = delete;
+
+  private:
+    Phase& phase;
+    ScopedBusyTimer timer;
+};
+
+} // namespace bb::stats
+
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define BB_STATS_CONCAT_INNER(a, b) a##b
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define BB_STATS_CONCAT(a, b) BB_STATS_CONCAT_INNER(a, b)
+// Times the enclosing scope. The name must be a string literal.
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define BB_STATS_PHASE(name)                                                                                           \
+    static ::bb::stats::Phase BB_STATS_CONCAT(_bb_stats_phase_def_, __LINE__)(name);                                   \
+    ::bb::stats::ScopedPhase BB_STATS_CONCAT(_bb_stats_phase_, __LINE__)(                                              \
+        BB_STATS_CONCAT(_bb_stats_phase_def_, __LINE__))
+// Adds to a counter, e.g. the number of MSMs. The name must be a string literal.
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define BB_STATS_ADD(name, value)                                                                                      \
+    do {                                                                                                               \
+        static ::bb::stats::Counter _bb_stats_counter(name, ::bb::stats::Counter::Kind::SUM);                          \
+        _bb_stats_counter.add(value);                                                                                  \
+    } while (0)
+// Keeps the largest value seen, e.g. the largest MSM. The name must be a string literal.
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define BB_STATS_MAX(name, value)                                                                                      \
+    do {                                                                                                               \
+        static ::bb::stats::Counter _bb_stats_counter(name, ::bb::stats::Counter::Kind::MAX);                          \
+        _bb_stats_counter.record_max(value);                                                                           \
+    } while (0)
@@ -0,0 +1,121 @@
+#include "stats.hpp"
+#include "thread.hpp"
+#include <chrono>
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+
+using namespace bb;
+
+namespace {
+void run_sumcheck()
+{
+    BB_STATS_PHASE("test/sumcheck");
+}
+
+void record_msm(uint64_t num_points)
+{
+    BB_STATS_ADD("test/msm_count", 1);
+    BB_STATS_MAX("test/msm_max_points", num_points);
+}
+} // namespace
+
+TEST(stats, PhasesCountRunsAndWallTime)
+{
+    stats::Stats::get().reset();
+    {
+        BB_STATS_PHASE("test/prove");
+        for (size_t i = 0; i < 2; i++) {
+            run_sumcheck();
+        }
+    }
+
+    auto phases = stats::Stats::get().get_phases();
+    EXPECT_EQ(phases["test/prove"].count, 1);
+    EXPECT_EQ(phases["test/sumcheck"].count, 2);
+    EXPECT_GE(phases["test/prove"].wall_ns, phases["test/sumcheck"].wall_ns);
+    EXPECT_GE(phases["test/sumcheck"].wall_ns, phases["test/sumcheck"].max_wall_ns);
+}
+
+TEST(stats, PhasesRecordTheThreadUtilization)
+{
+    stats::Stats::get().reset();
+    set_parallel_for_concurrency(4);
+    {
+        BB_STATS_PHASE("test/parallel");
+        parallel_for(4, [](size_t) { std::this_thread::sleep_for(std::chrono::milliseconds(2)); });
+    }
+
+    auto phase = stats::Stats::get().get_phases()["test/parallel"];
+    EXPECT_GT(phase.busy_ns, 0);
+    EXPECT_LE(phase.busy_ns, phase.wall_ns * 4);
+
+    std::string json = stats::Stats::get().to_json();
+    const size_t field = json.find("\"utilization\":", json.find("\"test/parallel\""));
+    ASSERT_NE(field, std::string::npos);
+    const double utilization = std::stod(json.substr(field + std::string("\"utilization\":").size()));
+    EXPECT_GT(utilization, 0.0);
+    EXPECT_LE(utilization, 1.0);
+    set_parallel_for_concurrency(0);
+}
+
+TEST(stats, NestedTimersAddTheirBusyTimeToTheEnclosingOne)
+{
+    stats::ScopedBusyTimer outer;
+    stats::ScopedBusyTimer::Times inner_times;
+    {
+        stats::ScopedBusyTimer inner;
+        parallel_for(2, [](size_t) {});
+        inner_times = inner.stop();
+    }
+    const stats::ScopedBusyTimer::Times outer_times = outer.stop();
+    EXPECT_LE(inner_times.wall_ns, outer_times.wall_ns);
+    EXPECT_LE(inner_times.busy_ns, outer_times.busy_ns);
+    EXPECT_EQ(get_thread_context().busy_ns, nullptr);
+}
+
+TEST(stats, CountersAccumulateOrKeepTheMaximum)
+{
+    stats::Stats::get().reset();
+    record_msm(1024);
+    record_msm(16);
+    record_msm(16);
+
+    auto counters = stats::Stats::get().get_counters();
+    EXPECT_EQ(counters["test/msm_count"], 3);
+    EXPECT_EQ(counters["test/msm_max_points"], 1024);
+}
+
+TEST(stats, StatisticsWithTheSameNameAreMerged)
+{
+    stats::Stats::get().reset();
+    static stats::Counter first("test/merged", stats::Counter::Kind::SUM);
+    static stats::Counter second("test/merged", stats::Counter::Kind::SUM);
+    first.add(1);
+    second.add(2);
+    EXPECT_EQ(stats::Stats::get().get_counters()["test/merged"], 3);
+}
+
+TEST(stats, ResetZeroesEveryStatistic)
+{
+    record_msm(8);
+    run_sumcheck();
+    stats::Stats::get().reset();
+    EXPECT_TRUE(stats::Stats::get().get_counters().empty());
+    EXPECT_TRUE(stats::Stats::get().get_phases().empty());
+}
+
+TEST(stats, ExportsJson)
+{
+    stats::Stats::get().reset();
+    run_sumcheck();
+    record_msm(1 << 10);
+
+    std::string json = stats::Stats::get().to_json();
+    EXPECT_EQ(json.front(), '{');
+    EXPECT_EQ(json.back(), '}');
+    EXPECT_NE(json.find("\"peak_rss_bytes\":"), std::string::npos);
+    EXPECT_NE(json.find("\"test/sumcheck\":{\"count\":1,\"wall_ms\":"), std::string::npos);
+    EXPECT_NE(json.find("\"counters\":{\"test/msm_count\":1,\"test/msm_max_points\":1024}"), std::string::npos);
+    EXPECT_GT(stats::peak_rss_bytes(), 0);
+}
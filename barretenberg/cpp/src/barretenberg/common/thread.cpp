@@ -1,5 +1,6 @@
 #include "thread.hpp"
 #include "log.hpp"
+#include <chrono>
 
 /**
  * There's a lot to talk about here. To bring threading to WASM, parallel_for was written to replace the OpenMP loops
@@ -34,9 +35,55 @@
  *
  * UPDATE!: Interestingly "atomic_pool" performs worse than "mutex_pool" for some e.g. proving key construction.
  * Haven't done deeper analysis. Defaulting to mutex_pool.
+ *
+ * UPDATE!: All of the above are flat fork-join pools that cannot nest (mutex_pool aborts on a nested call). Provers
+ * now run MSMs, sumcheck and witness generation inside each other's parallel regions, so we default to
+ * "work_stealing", which has per-worker deques and lets the calling thread help out instead of blocking. Run
+ * basics_bench (parallel_for_backend_*) to compare the backends.
  */
 
 namespace bb {
+namespace {
+std::atomic<size_t> parallel_for_concurrency = 0;
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+thread_local ThreadContext thread_context;
+
+// Runs the enclosing scope with the given context, and restores the context of the thread after it
+class ScopedThreadContext {
+  public:
+    explicit ScopedThreadContext(const ThreadContext& context)
+        : previous(thread_context)
+    {
+        thread_context = context;
+    }
+    ~ScopedThreadContext() { thread_context = previous; }
+    ScopedThreadContext(const ScopedThreadContext&) = delete;
+    ScopedThreadContext(ScopedThreadContext&&) = delete;
+    ScopedThreadContext& operator=(const ScopedThreadContext&) = delete;
+    ScopedThreadContext& operator=(ScopedThreadContext&&) = delete;
+
+  private:
+    ThreadContext previous;
+};
+} // namespace
+
+ThreadContext& get_thread_context()
+{
+    return thread_context;
+}
+
+size_t get_num_cpus()
+{
+    const size_t num_cpus = parallel_for_concurrency.load(std::memory_order_relaxed);
+    return num_cpus != 0 ? num_cpus : env_hardware_concurrency();
+}
+
+void set_parallel_for_concurrency(size_t num_cpus)
+{
+    parallel_for_concurrency.store(num_cpus, std::memory_order_relaxed);
+}
+
 // 64 core aws r5.
 // pippenger run: pippenger_bench/1048576
 // coset_fft run: coset_fft_bench_parallel/4194304
@@ -69,7 +116,10 @@ void parallel_for_atomic_pool(size_t num_iterations, const std::function<void(si
 
 void parallel_for_mutex_pool(size_t num_iterations, const std::function<void(size_t)>& func);
 
-void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func)
+void parallel_for_work_stealing(size_t num_iterations, const std::function<void(size_t)>& func);
+
+namespace {
+void parallel_for_backend(size_t num_iterations, const std::function<void(size_t)>& func)
 {
 #ifdef NO_MULTITHREADING
     for (size_t i = 0; i < num_iterations; ++i) {
@@ -82,11 +132,46 @@ void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func
     // parallel_for_spawning(num_iterations, func);
     // parallel_for_moody(num_iterations, func);
     // parallel_for_atomic_pool(num_iterations, func);
-    parallel_for_mutex_pool(num_iterations, func);
+    // parallel_for_mutex_pool(num_iterations, func);
     // parallel_for_queued(num_iterations, func);
+    parallel_for_work_stealing(num_iterations, func);
 #endif
 #endif
 }
+} // namespace
+
+void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func)
+{
+    const ThreadContext context = thread_context;
+    if (context.busy_ns == nullptr) {
+        if (context.polynomial_arena == nullptr) {
+            parallel_for_backend(num_iterations, func);
+            return;
+        }
+        // Each iteration runs with the context of the calling thread, whichever thread runs it
+        parallel_for_backend(num_iterations, [&](size_t i) {
+            ScopedThreadContext scoped_context(context);
+            func(i);
+        });
+        return;
+    }
+    // Inside a busy timer, the time spent in each iteration is busy time and the calling thread is waiting meanwhile.
+    // An iteration waiting for a nested parallel_for is not busy either.
+    const auto elapsed_ns = [](std::chrono::steady_clock::time_point start) {
+        return static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+    };
+    const auto start = std::chrono::steady_clock::now();
+    parallel_for_backend(num_iterations, [&](size_t i) {
+        ScopedThreadContext scoped_context(context);
+        uint64_t waiting_ns = 0;
+        thread_context.waiting_ns = &waiting_ns;
+        const auto iteration_start = std::chrono::steady_clock::now();
+        func(i);
+        context.busy_ns->fetch_add(elapsed_ns(iteration_start) - waiting_ns, std::memory_order_relaxed);
+    });
+    *context.waiting_ns += elapsed_ns(start);
+}
 
 /**
  * @brief Split a loop into several loops running in parallel
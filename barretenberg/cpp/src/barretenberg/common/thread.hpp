@@ -9,10 +9,16 @@
 
 namespace bb {
 
-inline size_t get_num_cpus()
-{
-    return env_hardware_concurrency();
-}
+/**
+ * @brief Number of threads used by parallel_for: the value set by set_parallel_for_concurrency if any, otherwise
+ * env_hardware_concurrency().
+ */
+size_t get_num_cpus();
+
+/**
+ * @brief Overrides the number of threads used by parallel_for, taking effect on the next call. 0 restores the default.
+ */
+void set_parallel_for_concurrency(size_t num_cpus);
 
 // For algorithms that need to be divided amongst power of 2 threads.
 inline size_t get_num_cpus_pow2()
@@ -20,6 +26,25 @@ inline size_t get_num_cpus_pow2()
     return static_cast<size_t>(1ULL << numeric::get_msb(get_num_cpus()));
 }
 
+/**
+ * @brief State of a thread that parallel_for hands over from the calling thread to the threads running its iterations
+ * @details Holds the PolynomialArena of the prover running on the thread (see polynomials/polynomial_arena.hpp), so
+ * that polynomials allocated inside a parallel_for come from the same arena as the ones allocated outside of it. Also
+ * holds the busy time of the innermost stats::ScopedBusyTimer of the thread (see stats.hpp), to which the threads
+ * running the iterations add the time they spend in them.
+ */
+struct ThreadContext {
+    void* polynomial_arena = nullptr;
+    std::atomic<uint64_t>* busy_ns = nullptr;
+    // Time the thread waited for parallel_for in the innermost timed scope, only set along with busy_ns
+    uint64_t* waiting_ns = nullptr;
+};
+
+/**
+ * @brief The context of the current thread
+ */
+ThreadContext& get_thread_context();
+
 /**
  * Creates a thread pool and runs the function in parallel.
  * @param num_iterations Number of iterations
@@ -144,6 +169,10 @@ constexpr size_t GE_DOUBLING_COST = 194;
 constexpr size_t SM_COST = 50000;
 // Field element (16 byte) sequential copy number
 constexpr size_t FF_COPY_COST = 3;
+// Poseidon2 hash of a pair of field elements, as in a Merkle tree node
+constexpr size_t HASH_PAIR_COST = 10000;
+// Lookup of a key in an LMDB database through an open read transaction
+constexpr size_t DB_LOOKUP_COST = 2000;
 // Fine default if something looks 'chunky enough that I don't want to calculate'
 constexpr size_t ALWAYS_MULTITHREAD = 100000;
 } // namespace thread_heuristics
@@ -0,0 +1,112 @@
+#include "thread.hpp"
+#include <atomic>
+#include <gtest/gtest.h>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace bb;
+
+TEST(thread, ParallelForVisitsEveryIterationOnce)
+{
+    constexpr size_t num_iterations = 1 << 12;
+    std::vector<std::atomic<size_t>> visits(num_iterations);
+    parallel_for(num_iterations, [&](size_t i) { visits[i]++; });
+    for (auto& visit : visits) {
+        EXPECT_EQ(visit.load(), 1U);
+    }
+}
+
+TEST(thread, ParallelForZeroIterations)
+{
+    bool called = false;
+    parallel_for(0, [&](size_t) { called = true; });
+    EXPECT_FALSE(called);
+}
+
+TEST(thread, NestedParallelFor)
+{
+    constexpr size_t num_outer = 8;
+    constexpr size_t num_inner = 256;
+    std::vector<std::vector<size_t>> result(num_outer, std::vector<size_t>(num_inner, 0));
+    parallel_for(num_outer, [&](size_t i) {
+        parallel_for(num_inner, [&](size_t j) { result[i][j] = i * num_inner + j; });
+    });
+    for (size_t i = 0; i < num_outer; ++i) {
+        for (size_t j = 0; j < num_inner; ++j) {
+            EXPECT_EQ(result[i][j], i * num_inner + j);
+        }
+    }
+}
+
+TEST(thread, NestedParallelForRange)
+{
+    constexpr size_t num_points = 1 << 14;
+    std::vector<size_t> values(num_points);
+    parallel_for_range(num_points, [&](size_t start, size_t end) {
+        parallel_for_range(end - start, [&](size_t inner_start, size_t inner_end) {
+            for (size_t i = start + inner_start; i < start + inner_end; ++i) {
+                values[i] = i;
+            }
+        });
+    });
+    std::vector<size_t> expected(num_points);
+    std::iota(expected.begin(), expected.end(), 0);
+    EXPECT_EQ(values, expected);
+}
+
+#if !defined(NO_MULTITHREADING) && !defined(__wasm__)
+TEST(thread, ParallelForPropagatesException)
+{
+    std::atomic<size_t> completed = 0;
+    EXPECT_THROW(parallel_for(64,
+                              [&](size_t i) {
+                                  if (i == 17) {
+                                      throw std::runtime_error("iteration failed");
+                                  }
+                                  completed++;
+                              }),
+                 std::runtime_error);
+    // Every other iteration still ran to completion before the exception was rethrown.
+    EXPECT_EQ(completed.load(), 63U);
+    // And the pool is still usable afterwards.
+    std::atomic<size_t> count = 0;
+    parallel_for(64, [&](size_t) { count++; });
+    EXPECT_EQ(count.load(), 64U);
+}
+
+TEST(thread, ParallelForFollowsConcurrency)
+{
+    const auto caller = std::this_thread::get_id();
+    std::atomic<size_t> off_caller = 0;
+    set_parallel_for_concurrency(1);
+    parallel_for(256, [&](size_t) { off_caller += std::this_thread::get_id() != caller ? 1 : 0; });
+    EXPECT_EQ(off_caller.load(), 0U);
+
+    set_parallel_for_concurrency(4);
+    EXPECT_EQ(get_num_cpus(), 4U);
+    std::atomic<size_t> count = 0;
+    parallel_for(256, [&](size_t) { count++; });
+    EXPECT_EQ(count.load(), 256U);
+    set_parallel_for_concurrency(0);
+}
+
+TEST(thread, ConcurrentExternalCallers)
+{
+    // Threads outside the pool each wait for their own nested loops only.
+    std::vector<std::thread> callers;
+    std::vector<size_t> totals(4, 0);
+    for (size_t t = 0; t < totals.size(); ++t) {
+        callers.emplace_back([&totals, t] {
+            std::atomic<size_t> count = 0;
+            parallel_for(16, [&](size_t) { parallel_for(16, [&](size_t) { count++; }); });
+            totals[t] = count.load();
+        });
+    }
+    for (auto& caller : callers) {
+        caller.join();
+    }
+    EXPECT_EQ(totals, std::vector<size_t>(4, 256));
+}
+#endif
@@ -3,20 +3,26 @@
 #include "../node_store//tree_meta.hpp"
 #include "../response.hpp"
 #include "../types.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/thread_pool.hpp"
 #include "barretenberg/crypto/merkle_tree/indexed_tree/indexed_leaf.hpp"
 #include "barretenberg/crypto/merkle_tree/lmdb_store/lmdb_tree_store.hpp"
 #include "barretenberg/crypto/merkle_tree/signal.hpp"
 #include "barretenberg/numeric/bitop/pow.hpp"
+#include <algorithm>
+#include <condition_variable>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
 #include <functional>
 #include <iostream>
 #include <memory>
+#include <mutex>
+#include <numeric>
 #include <optional>
 #include <ostream>
 #include <random>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <utility>
@@ -43,6 +49,7 @@ template <typename Store, typename HashingPolicy> class ContentAddressedAppendOn
     using AppendCompletionCallback = std::function<void(TypedResponse<AddDataResponse>&)>;
     using MetaDataCallback = std::function<void(TypedResponse<TreeMetaResponse>&)>;
     using HashPathCallback = std::function<void(TypedResponse<GetSiblingPathResponse>&)>;
+    using HashPathsCallback = std::function<void(TypedResponse<GetSiblingPathsResponse>&)>;
     using FindLeafCallback = std::function<void(TypedResponse<FindLeafIndexResponse>&)>;
     using GetLeafCallback = std::function<void(TypedResponse<GetLeafResponse>&)>;
     using CommitCallback = std::function<void(TypedResponse<CommitResponse>&)>;
@@ -64,7 +71,7 @@ template <typename Store, typename HashingPolicy> class ContentAddressedAppendOn
     ContentAddressedAppendOnlyTree(ContentAddressedAppendOnlyTree&& other) = delete;
     ContentAddressedAppendOnlyTree& operator=(ContentAddressedAppendOnlyTree const& other) = delete;
     ContentAddressedAppendOnlyTree& operator=(ContentAddressedAppendOnlyTree const&& other) = delete;
-    virtual ~ContentAddressedAppendOnlyTree() = default;
+    virtual ~ContentAddressedAppendOnlyTree();
 
     /**
      * @brief Adds a single value to the end of the tree
@@ -100,6 +107,30 @@ template <typename Store, typename HashingPolicy> class ContentAddressedAppendOn
                           const HashPathCallback& on_completion,
                           bool includeUncommitted) const;
 
+    /**
+     * @brief Returns the sibling paths and leaf hashes of the leaves at the given indices, from a single read
+     * transaction. Nodes shared by several of the paths are only read once.
+     * @param indices The indices at which to read the sibling paths
+     * @param on_completion Callback to be called on completion
+     * @param includeUncommitted Whether to include uncommitted changes
+     */
+    void get_sibling_paths(const std::vector<index_t>& indices,
+                           const HashPathsCallback& on_completion,
+                           bool includeUncommitted) const;
+
+    /**
+     * @brief Returns the sibling paths and leaf hashes of the leaves at the given indices, from a single read
+     * transaction. Nodes shared by several of the paths are only read once.
+     * @param indices The indices at which to read the sibling paths
+     * @param blockNumber The block number of the tree to use as a reference
+     * @param on_completion Callback to be called on completion
+     * @param includeUncommitted Whether to include uncommitted changes
+     */
+    void get_sibling_paths(const std::vector<index_t>& indices,
+                           const block_number_t& blockNumber,
+                           const HashPathsCallback& on_completion,
+                           bool includeUncommitted) const;
+
     /**
      * @brief Get the subtree sibling path object
      *
@@ -211,6 +242,14 @@ template <typename Store, typename HashingPolicy> class ContentAddressedAppendOn
      */
     void commit(const CommitCallback& on_completion);
 
+    /**
+     * @brief Commit the tree, writing it to the backing store in the background
+     * @details on_committed is called once the uncommitted changes have become the committed state of a new block,
+     * from when new changes can be made to the tree. The block is then written on the tree's writer thread and
+     * on_persisted is called, with the database stats, once it is in the backing store.
+     */
+    void commit_async(const CommitCallback& on_committed, const CommitCallback& on_persisted);
+
     /**
      * @brief Rollback the uncommitted changes
      */
@@ -248,6 +287,11 @@ template <typename Store, typename HashingPolicy> class ContentAddressedAppendOn
                              const AppendCompletionCallback& on_completion,
                              bool update_index);
 
+    void get_sibling_paths_internal(const std::vector<index_t>& indices,
+                                    const RequestContext& requestContext,
+                                    ReadTransaction& tx,
+                                    TypedResponse<GetSiblingPathsResponse>& response) const;
+
     OptionalSiblingPath get_subtree_sibling_path_internal(const index_t& leaf_index,
                                                           uint32_t subtree_depth,
                                                           const RequestContext& requestContext,
@@ -261,13 +305,19 @@ template <typename Store, typename HashingPolicy> class ContentAddressedAppendOn
     index_t get_batch_insertion_size(const index_t& treeSize, const index_t& remainingAppendSize);
 
     void add_batch_internal(
-        std::vector<fr>& values, fr& new_root, index_t& new_size, bool update_index, ReadTransaction& tx);
+        std::span<const fr> values, fr& new_root, index_t& new_size, bool update_index, ReadTransaction& tx);
 
     std::unique_ptr<Store> store_;
     uint32_t depth_;
     uint64_t max_size_;
     std::vector<fr> zero_hashes_;
     std::shared_ptr<ThreadPool> workers_;
+    // Writes committed blocks to the store, created by the first commit_async
+    std::unique_ptr<ThreadPool> writer_;
+    // The number of commit_async jobs on workers_ that have yet to hand their block to writer_
+    size_t commitsQueued_ = 0;
+    std::mutex commitsMtx_;
+    std::condition_variable commitsCondition_;
 };
 
 template <typename Store, typename HashingPolicy>
@@ -412,6 +462,59 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::get_sibling_path(cons
     workers_->enqueue(job);
 }
 
+template <typename Store, typename HashingPolicy>
+void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::get_sibling_paths(const std::vector<index_t>& indices,
+                                                                             const HashPathsCallback& on_completion,
+                                                                             bool includeUncommitted) const
+{
+    auto job = [=, this]() {
+        execute_and_report<GetSiblingPathsResponse>(
+            [=, this](TypedResponse<GetSiblingPathsResponse>& response) {
+                ReadTransactionPtr tx = store_->create_read_transaction();
+                TreeMeta meta;
+                store_->get_meta(meta, *tx, includeUncommitted);
+                RequestContext requestContext;
+                requestContext.includeUncommitted = includeUncommitted;
+                requestContext.root = store_->get_current_root(*tx, includeUncommitted);
+                requestContext.maxIndex = meta.size;
+                get_sibling_paths_internal(indices, requestContext, *tx, response);
+            },
+            on_completion);
+    };
+    workers_->enqueue(job);
+}
+
+template <typename Store, typename HashingPolicy>
+void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::get_sibling_paths(const std::vector<index_t>& indices,
+                                                                             const block_number_t& blockNumber,
+                                                                             const HashPathsCallback& on_completion,
+                                                                             bool includeUncommitted) const
+{
+    auto job = [=, this]() {
+        execute_and_report<GetSiblingPathsResponse>(
+            [=, this](TypedResponse<GetSiblingPathsResponse>& response) {
+                if (blockNumber == 0) {
+                    throw std::runtime_error("Unable to get sibling paths at block 0");
+                }
+                ReadTransactionPtr tx = store_->create_read_transaction();
+                BlockPayload blockData;
+                if (!store_->get_block_data(blockNumber, blockData, *tx)) {
+                    throw std::runtime_error(
+                        format("Unable to get sibling paths at block ", blockNumber, ", failed to get block data."));
+                }
+
+                RequestContext requestContext;
+                requestContext.blockNumber = blockNumber;
+                requestContext.includeUncommitted = includeUncommitted;
+                requestContext.root = blockData.root;
+                requestContext.maxIndex = blockData.size;
+                get_sibling_paths_internal(indices, requestContext, *tx, response);
+            },
+            on_completion);
+    };
+    workers_->enqueue(job);
+}
+
 template <typename Store, typename HashingPolicy>
 void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::find_block_numbers(
     const std::vector<index_t>& indices, const GetBlockForIndexCallback& on_completion) const
@@ -595,6 +698,92 @@ std::optional<fr> ContentAddressedAppendOnlyTree<Store, HashingPolicy>::find_lea
     return std::optional<fr>(hash);
 }
 
+template <typename Store, typename HashingPolicy>
+void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::get_sibling_paths_internal(
+    const std::vector<index_t>& indices,
+    const RequestContext& requestContext,
+    ReadTransaction& tx,
+    TypedResponse<GetSiblingPathsResponse>& typedResponse) const
+{
+    // Leaves at or beyond the size of the tree (at the requested block) have no path yet
+    const index_t size = std::min<index_t>(requestContext.maxIndex.value_or(max_size_), max_size_);
+    for (const index_t& index : indices) {
+        if (index >= size) {
+            typedResponse.success = false;
+            typedResponse.message = format("Unable to get sibling path for index ",
+                                           index,
+                                           ", leaf index out of range. Tree size: ",
+                                           size,
+                                           ", max size: ",
+                                           max_size_);
+            return;
+        }
+    }
+
+    GetSiblingPathsResponse& response = typedResponse.inner;
+    response.paths.assign(indices.size(), fr_sibling_path(depth_));
+    response.leaves.assign(indices.size(), std::nullopt);
+
+    // Visit the leaves in index order, so that the leaves below any node form a contiguous range of this ordering
+    std::vector<size_t> order(indices.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return indices[a] < indices[b]; });
+
+    struct Subtree {
+        fr hash;
+        uint32_t level;
+        // Whether every node from the root to here is present, otherwise the leaves below are empty
+        bool present;
+        size_t begin;
+        size_t end;
+    };
+
+    // Walk down from the root reading each node once, splitting the range of leaves between its children
+    std::vector<Subtree> stack{ { requestContext.root, 0, true, 0, order.size() } };
+    while (!stack.empty()) {
+        Subtree subtree = stack.back();
+        stack.pop_back();
+        if (subtree.begin == subtree.end) {
+            continue;
+        }
+        if (subtree.level == depth_) {
+            for (size_t i = subtree.begin; i < subtree.end; ++i) {
+                response.leaves[order[i]] = subtree.present ? std::optional<fr>(subtree.hash) : std::nullopt;
+            }
+            continue;
+        }
+
+        NodePayload nodePayload;
+        store_->get_node_by_hash(subtree.hash, nodePayload, tx, requestContext.includeUncommitted);
+
+        const index_t mask = index_t(1) << (depth_ - 1 - subtree.level);
+        size_t split = static_cast<size_t>(
+            std::partition_point(order.begin() + static_cast<std::ptrdiff_t>(subtree.begin),
+                                 order.begin() + static_cast<std::ptrdiff_t>(subtree.end),
+                                 [&](size_t i) { return (indices[i] & mask) == 0; }) -
+            order.begin());
+
+        const fr& zero_hash = zero_hashes_[subtree.level + 1];
+        const size_t path_index = depth_ - 1 - subtree.level;
+        for (size_t i = subtree.begin; i < split; ++i) {
+            response.paths[order[i]][path_index] = nodePayload.right.value_or(zero_hash);
+        }
+        for (size_t i = split; i < subtree.end; ++i) {
+            response.paths[order[i]][path_index] = nodePayload.left.value_or(zero_hash);
+        }
+        stack.push_back({ nodePayload.left.value_or(zero_hash),
+                          subtree.level + 1,
+                          subtree.present && nodePayload.left.has_value(),
+                          subtree.begin,
+                          split });
+        stack.push_back({ nodePayload.right.value_or(zero_hash),
+                          subtree.level + 1,
+                          subtree.present && nodePayload.right.has_value(),
+                          split,
+                          subtree.end });
+    }
+}
+
 template <typename Store, typename HashingPolicy>
 ContentAddressedAppendOnlyTree<Store, HashingPolicy>::OptionalSiblingPath ContentAddressedAppendOnlyTree<
     Store,
@@ -844,6 +1033,59 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::commit(const CommitCa
     workers_->enqueue(job);
 }
 
+template <typename Store, typename HashingPolicy>
+ContentAddressedAppendOnlyTree<Store, HashingPolicy>::~ContentAddressedAppendOnlyTree()
+{
+    // The jobs of commit_async run on the shared workers_ and then on writer_, wait for them to be on writer_ before
+    // joining it, which writes the blocks still queued on it
+    {
+        std::unique_lock lock(commitsMtx_);
+        commitsCondition_.wait(lock, [this] { return commitsQueued_ == 0; });
+    }
+    writer_.reset();
+}
+
+template <typename Store, typename HashingPolicy>
+void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::commit_async(const CommitCallback& on_committed,
+                                                                        const CommitCallback& on_persisted)
+{
+    if (!writer_) {
+        writer_ = std::make_unique<ThreadPool>(1);
+    }
+    {
+        std::unique_lock lock(commitsMtx_);
+        ++commitsQueued_;
+    }
+    auto job = [=, this]() {
+        TypedResponse<CommitResponse> committed;
+        execute_and_report<CommitResponse>(
+            [=, this](TypedResponse<CommitResponse>& response) { store_->freeze_block(response.inner.meta); },
+            [&](TypedResponse<CommitResponse>& response) {
+                committed = response;
+                on_committed(response);
+            });
+        if (committed.success) {
+            auto persist = [=, this]() {
+                execute_and_report<CommitResponse>(
+                    [=, this](TypedResponse<CommitResponse>& response) {
+                        response.inner.meta = committed.inner.meta;
+                        store_->persist_frozen_block(response.inner.stats);
+                    },
+                    on_persisted);
+            };
+            writer_->enqueue(persist);
+        } else {
+            // Nothing to write
+            on_persisted(committed);
+        }
+        // Notified under the lock, as the tree may be destroyed as soon as it is released
+        std::unique_lock lock(commitsMtx_);
+        --commitsQueued_;
+        commitsCondition_.notify_all();
+    };
+    workers_->enqueue(job);
+}
+
 template <typename Store, typename HashingPolicy>
 void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::rollback(const RollbackCallback& on_completion)
 {
@@ -965,9 +1207,7 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::add_values_internal(s
     while (sizeToAppend != 0U) {
         index_t batchSize = get_batch_insertion_size(new_size, sizeToAppend);
         sizeToAppend -= batchSize;
-        int64_t start = static_cast<int64_t>(batchIndex);
-        int64_t end = static_cast<int64_t>(batchIndex + batchSize);
-        std::vector<fr> batch = std::vector<fr>(values->begin() + start, values->begin() + end);
+        std::span<const fr> batch = std::span<const fr>(*values).subspan(batchIndex, batchSize);
         batchIndex += batchSize;
         add_batch_internal(batch, new_root, new_size, update_index, *tx);
     }
@@ -975,12 +1215,11 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::add_values_internal(s
 
 template <typename Store, typename HashingPolicy>
 void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::add_batch_internal(
-    std::vector<fr>& values, fr& new_root, index_t& new_size, bool update_index, ReadTransaction& tx)
+    std::span<const fr> values, fr& new_root, index_t& new_size, bool update_index, ReadTransaction& tx)
 {
     uint32_t start_level = depth_;
     uint32_t level = start_level;
-    std::vector<fr>& hashes_local = values;
-    auto number_to_insert = static_cast<uint32_t>(hashes_local.size());
+    auto number_to_insert = static_cast<uint32_t>(values.size());
 
     TreeMeta meta;
     store_->get_meta(meta);
@@ -999,43 +1238,51 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::add_batch_internal(
 
     // Add the values at the leaf nodes of the tree
     for (uint32_t i = 0; i < number_to_insert; ++i) {
-        // write_node(level, index + i, hashes_local[i]);
-        // std::cout << "Writing leaf hash: " << hashes_local[i] << " level " << level << std::endl;
-        store_->put_node_by_hash(hashes_local[i], { .left = std::nullopt, .right = std::nullopt, .ref = 1 });
-        store_->put_cached_node_by_index(level, i + index, hashes_local[i]);
+        // write_node(level, index + i, values[i]);
+        // std::cout << "Writing leaf hash: " << values[i] << " level " << level << std::endl;
+        store_->put_node_by_hash(values[i], { .left = std::nullopt, .right = std::nullopt, .ref = 1 });
+        store_->put_cached_node_by_index(level, i + index, values[i]);
     }
 
     // If we have been told to add these leaves to the index then do so now
     if (update_index) {
         for (uint32_t i = 0; i < number_to_insert; ++i) {
             // We don't store indices of zero leaves
-            if (hashes_local[i] == fr::zero()) {
+            if (values[i] == fr::zero()) {
                 continue;
             }
-            // std::cout << "Updating index " << index + i << " : " << hashes_local[i] << std::endl;
-            store_->update_index(index + i, hashes_local[i]);
+            // std::cout << "Updating index " << index + i << " : " << values[i] << std::endl;
+            store_->update_index(index + i, values[i]);
         }
     }
 
-    // Hash the values as a sub tree and insert them
+    // Hash the values as a sub tree and insert them. Each level is computed by one parallel pass of batched hashes
+    // from the contiguous array of the level below, and only then written to the cache, which is not thread safe
+    std::span<const fr> children = values;
+    std::vector<fr> hashes_local;
+    std::vector<fr> parents;
     while (number_to_insert > 1) {
         number_to_insert >>= 1;
         index >>= 1;
         --level;
-        // std::cout << "To INSERT " << number_to_insert << std::endl;
+        parents.resize(number_to_insert);
+        parallel_for_heuristic(
+            number_to_insert,
+            [&](size_t start, size_t end, BB_UNUSED size_t chunk_index) {
+                HashingPolicy::hash_pairs(children.subspan(2 * start, 2 * (end - start)),
+                                          std::span<fr>(parents).subspan(start, end - start));
+            },
+            thread_heuristics::HASH_PAIR_COST);
         for (uint32_t i = 0; i < number_to_insert; ++i) {
-            fr left = hashes_local[i * 2];
-            fr right = hashes_local[i * 2 + 1];
-            hashes_local[i] = HashingPolicy::hash_pair(left, right);
-            // std::cout << "Left: " << left << ", right: " << right << ", parent: " << hashes_local[i] << std::endl;
-            store_->put_node_by_hash(hashes_local[i], { .left = left, .right = right, .ref = 1 });
-            store_->put_cached_node_by_index(level, index + i, hashes_local[i]);
-            // std::cout << "Writing node hash " << hashes_local[i] << " level " << level << " index " << index + i
-            //           << std::endl;
+            store_->put_node_by_hash(parents[i], { .left = children[i * 2], .right = children[i * 2 + 1], .ref = 1 });
+            store_->put_cached_node_by_index(level, index + i, parents[i]);
         }
+        // The level just computed holds the children of the next one
+        std::swap(hashes_local, parents);
+        children = hashes_local;
     }
 
-    fr new_hash = hashes_local[0];
+    fr new_hash = children[0];
 
     // std::cout << "LEVEL: " << level << " hash " << new_hash << std::endl;
     RequestContext requestContext;
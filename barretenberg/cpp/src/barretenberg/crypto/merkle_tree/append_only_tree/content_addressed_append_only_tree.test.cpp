@@ -140,6 +140,32 @@ void check_historic_sibling_path(TreeType& tree,
     signal.wait_for_level();
 }
 
+void check_sibling_paths(TreeType& tree,
+                         const std::vector<index_t>& indices,
+                         const std::vector<fr_sibling_path>& expected_paths,
+                         const std::vector<std::optional<fr>>& expected_leaves,
+                         std::optional<block_number_t> blockNumber = std::nullopt,
+                         bool expected_success = true)
+{
+    Signal signal;
+    auto completion = [&](const TypedResponse<GetSiblingPathsResponse>& response) -> void {
+        EXPECT_EQ(response.success, expected_success);
+        if (expected_success) {
+            EXPECT_EQ(response.inner.paths, expected_paths);
+            EXPECT_EQ(response.inner.leaves, expected_leaves);
+        } else {
+            EXPECT_FALSE(response.message.empty());
+        }
+        signal.signal_level();
+    };
+    if (blockNumber.has_value()) {
+        tree.get_sibling_paths(indices, blockNumber.value(), completion, false);
+    } else {
+        tree.get_sibling_paths(indices, completion, true);
+    }
+    signal.wait_for_level();
+}
+
 void commit_tree(TreeType& tree, bool expected_success = true)
 {
     Signal signal;
@@ -812,6 +838,57 @@ TEST_F(PersistedContentAddressedAppendOnlyTreeTest, can_commit_multiple_blocks)
     }
 }
 
+TEST_F(PersistedContentAddressedAppendOnlyTreeTest, can_commit_blocks_in_the_background)
+{
+    constexpr size_t depth = 10;
+    std::string name = random_string();
+    LMDBTreeStore::SharedPtr db = std::make_shared<LMDBTreeStore>(_directory, name, _mapSize, _maxReaders);
+    std::unique_ptr<Store> store = std::make_unique<Store>(name, depth, db);
+    ThreadPoolPtr pool = make_thread_pool(1);
+    TreeType tree(std::move(store), pool);
+    MemoryTree<Poseidon2HashPolicy> memdb(depth);
+
+    constexpr uint32_t num_blocks = 10;
+    constexpr uint32_t batch_size = 4;
+    Signal persisted(num_blocks);
+    for (uint32_t i = 0; i < num_blocks; i++) {
+        std::vector<fr> to_add;
+        for (size_t j = 0; j < batch_size; ++j) {
+            size_t ind = i * batch_size + j;
+            memdb.update_element(ind, VALUES[ind]);
+            to_add.push_back(VALUES[ind]);
+        }
+        add_values(tree, to_add);
+
+        Signal committed;
+        tree.commit_async(
+            [&](const TypedResponse<CommitResponse>& response) {
+                EXPECT_EQ(response.success, true);
+                EXPECT_EQ(response.inner.meta.unfinalisedBlockHeight, i + 1);
+                committed.signal_level();
+            },
+            [&](const TypedResponse<CommitResponse>& response) {
+                EXPECT_EQ(response.success, true);
+                persisted.signal_decrement();
+            });
+        committed.wait_for_level();
+
+        // The block is committed state whether or not it has been written yet
+        index_t expected_size = (i + 1) * batch_size;
+        check_size(tree, expected_size, false);
+        check_block_height(tree, i + 1);
+        check_root(tree, memdb.root(), false);
+        check_leaf(tree, VALUES[expected_size - 1], expected_size - 1, true, false);
+        check_find_leaf_index(tree, VALUES[expected_size - 1], expected_size - 1, true, false);
+        check_historic_sibling_path(tree, 0, memdb.get_sibling_path(0), i + 1);
+        std::vector<std::optional<block_number_t>> blockNumbers;
+        get_blocks_for_indices(tree, { expected_size - 1 }, blockNumbers);
+        EXPECT_EQ(blockNumbers[0], i + 1);
+    }
+    persisted.wait_for_level();
+    check_block_and_root_data(db, num_blocks, memdb.root(), true);
+}
+
 TEST_F(PersistedContentAddressedAppendOnlyTreeTest, can_add_varying_size_blocks)
 {
     constexpr size_t depth = 10;
@@ -898,6 +975,69 @@ TEST_F(PersistedContentAddressedAppendOnlyTreeTest, can_retrieve_historic_siblin
     }
 }
 
+TEST_F(PersistedContentAddressedAppendOnlyTreeTest, can_retrieve_many_sibling_paths)
+{
+    constexpr size_t depth = 10;
+    std::string name = random_string();
+    LMDBTreeStore::SharedPtr db = std::make_shared<LMDBTreeStore>(_directory, name, _mapSize, _maxReaders);
+    std::unique_ptr<Store> store = std::make_unique<Store>(name, depth, db);
+    ThreadPoolPtr pool = make_thread_pool(1);
+    TreeType tree(std::move(store), pool);
+    MemoryTree<Poseidon2HashPolicy> memdb(depth);
+
+    // Unordered and repeated
+    std::vector<index_t> indices{ 36, 0, 5, 5, 17, 1, 36, 4 };
+    auto expected_paths = [&](const std::vector<index_t>& leafIndices) {
+        std::vector<fr_sibling_path> paths;
+        for (index_t index : leafIndices) {
+            paths.push_back(memdb.get_sibling_path(index));
+        }
+        return paths;
+    };
+    auto expected_leaves = [&](const std::vector<index_t>& leafIndices) {
+        std::vector<std::optional<fr>> leaves;
+        for (index_t index : leafIndices) {
+            leaves.push_back(VALUES[index]);
+        }
+        return leaves;
+    };
+
+    // Nothing to read from an empty tree
+    check_sibling_paths(tree, { 0 }, {}, {}, std::nullopt, false);
+
+    std::vector<fr> values(VALUES.begin(), VALUES.begin() + 37);
+    for (size_t i = 0; i < values.size(); ++i) {
+        memdb.update_element(i, values[i]);
+    }
+    add_values(tree, values);
+    commit_tree(tree);
+    std::vector<fr_sibling_path> block_1_paths = expected_paths(indices);
+    check_sibling_paths(tree, indices, block_1_paths, expected_leaves(indices));
+
+    values = std::vector<fr>(VALUES.begin() + 37, VALUES.begin() + 50);
+    for (size_t i = 0; i < values.size(); ++i) {
+        memdb.update_element(37 + i, values[i]);
+    }
+    add_values(tree, values);
+    check_sibling_paths(tree, indices, expected_paths(indices), expected_leaves(indices));
+    check_sibling_paths(tree, indices, block_1_paths, expected_leaves(indices), 1);
+
+    // The uncommitted leaves are beyond the end of the tree at block 1
+    std::vector<index_t> uncommitted_indices{ 40, 37, 49 };
+    check_sibling_paths(
+        tree, uncommitted_indices, expected_paths(uncommitted_indices), expected_leaves(uncommitted_indices));
+    check_sibling_paths(tree, uncommitted_indices, {}, {}, 1, false);
+
+    // A single index beyond the end of the tree fails the whole query
+    check_sibling_paths(tree, { 0, 50 }, {}, {}, std::nullopt, false);
+    check_sibling_paths(tree, { 0, 1024 }, {}, {}, std::nullopt, false);
+
+    // The batched paths match those read one at a time
+    for (index_t index : indices) {
+        check_sibling_path(tree, index, memdb.get_sibling_path(index));
+    }
+}
+
 TEST_F(PersistedContentAddressedAppendOnlyTreeTest, retrieves_historic_leaves)
 {
     constexpr size_t depth = 10;
@@ -3,6 +3,7 @@
 #include "../hash_path.hpp"
 #include "../signal.hpp"
 #include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/thread_pool.hpp"
 #include "barretenberg/crypto/merkle_tree/append_only_tree/content_addressed_append_only_tree.hpp"
 #include "barretenberg/crypto/merkle_tree/lmdb_store/lmdb_tree_store.hpp"
@@ -919,149 +920,183 @@ void ContentAddressedIndexedTree<Store, HashingPolicy>::generate_insertions(
 
             // std::cout << "Generating insertions " << std::endl;
 
-            // Now that we have the sorted values we need to identify the leaves that need updating.
-            // This is performed sequentially and is stored in this 'leaf_update' struct
             response.inner.highest_index = 0;
             response.inner.low_leaf_updates = std::make_shared<std::vector<LeafUpdate>>();
             response.inner.low_leaf_updates->reserve(values.size());
             response.inner.leaves_to_append =
                 std::make_shared<std::vector<IndexedLeafValueType>>(values.size(), IndexedLeafValueType::empty());
             index_t num_leaves_to_be_inserted = values.size();
-            std::set<uint256_t> unique_values;
 
-            {
-                ReadTransactionPtr tx = store_->create_read_transaction();
-                TreeMeta meta;
-                store_->get_meta(meta);
-                RequestContext requestContext;
-                requestContext.includeUncommitted = true;
-                //  Ensure that the tree is not going to be overfilled
-                index_t new_total_size = num_leaves_to_be_inserted + meta.size;
-                if (new_total_size > max_size_) {
-                    throw std::runtime_error(format("Unable to insert values into tree ",
-                                                    meta.name,
-                                                    " new size: ",
-                                                    new_total_size,
-                                                    " max size: ",
-                                                    max_size_));
+            TreeMeta meta;
+            store_->get_meta(meta);
+            RequestContext requestContext;
+            requestContext.includeUncommitted = true;
+            //  Ensure that the tree is not going to be overfilled
+            index_t new_total_size = num_leaves_to_be_inserted + meta.size;
+            if (new_total_size > max_size_) {
+                throw std::runtime_error(format("Unable to insert values into tree ",
+                                                meta.name,
+                                                " new size: ",
+                                                new_total_size,
+                                                " max size: ",
+                                                max_size_));
+            }
+
+            // The sort places duplicate keys next to each other
+            std::optional<uint256_t> previous_key;
+            for (const auto& [leaf_value, _] : values) {
+                if (leaf_value.is_empty()) {
+                    continue;
                 }
-                for (size_t i = 0; i < values.size(); ++i) {
-                    std::pair<LeafValueType, size_t>& value_pair = values[i];
-                    size_t index_into_appended_leaves = value_pair.second;
-                    index_t index_of_new_leaf = static_cast<index_t>(index_into_appended_leaves) + meta.size;
-                    if (value_pair.first.is_empty()) {
-                        continue;
-                    }
-                    fr value = value_pair.first.get_key();
-                    auto it = unique_values.insert(value);
-                    if (!it.second) {
-                        throw std::runtime_error(format(
-                            "Duplicate key not allowed in same batch, key value: ", value, ", tree: ", meta.name));
-                    }
+                uint256_t key = leaf_value.get_key();
+                if (previous_key == key) {
+                    throw std::runtime_error(format("Duplicate key not allowed in same batch, key value: ",
+                                                    fr(key),
+                                                    ", tree: ",
+                                                    meta.name));
+                }
+                previous_key = key;
+            }
 
-                    // This gives us the leaf that need updating
-                    index_t low_leaf_index = 0;
-                    bool is_already_present = false;
-
-                    requestContext.root = store_->get_current_root(*tx, true);
-                    std::tie(is_already_present, low_leaf_index) =
-                        store_->find_low_value(value_pair.first.get_key(), requestContext, *tx);
-                    // std::cout << "Found low leaf index " << low_leaf_index << std::endl;
-
-                    // Try and retrieve the leaf pre-image from the cache first.
-                    // If unsuccessful, derive from the tree and hash based lookup
-                    std::optional<IndexedLeafValueType> optional_low_leaf =
-                        store_->get_cached_leaf_by_index(low_leaf_index);
-                    IndexedLeafValueType low_leaf;
-
-                    if (optional_low_leaf.has_value()) {
-                        low_leaf = optional_low_leaf.value();
-                        // std::cout << "Found cached low leaf at index: " << low_leaf_index << " : " << low_leaf
-                        //           << std::endl;
-                    } else {
-                        // std::cout << "Looking for leaf at index " << low_leaf_index << std::endl;
-                        std::optional<fr> low_leaf_hash = find_leaf_hash(low_leaf_index, requestContext, *tx, true);
-
-                        if (!low_leaf_hash.has_value()) {
-                            // std::cout << "Failed to find low leaf" << std::endl;
-                            throw std::runtime_error(format("Unable to insert values into tree ",
-                                                            meta.name,
-                                                            ", failed to find low leaf at index ",
-                                                            low_leaf_index,
-                                                            ", current size: ",
-                                                            meta.size));
+            // Values are inserted in descending order, so the keys inserted by the batch before a value are all greater
+            // than it and never become its low leaf. The low leaves of all the values can therefore be found in
+            // parallel against the state of the tree before the batch. Each thread needs its own read transaction.
+            std::vector<std::pair<bool, index_t>> low_leaf_lookups(values.size());
+            parallel_for_heuristic(
+                values.size(),
+                [&](size_t start, size_t end, BB_UNUSED size_t chunk_index) {
+                    ReadTransactionPtr tx = store_->create_read_transaction();
+                    RequestContext chunkRequestContext = requestContext;
+                    chunkRequestContext.root = store_->get_current_root(*tx, true);
+                    for (size_t i = start; i < end; ++i) {
+                        if (!values[i].first.is_empty()) {
+                            low_leaf_lookups[i] =
+                                store_->find_low_value(values[i].first.get_key(), chunkRequestContext, *tx);
                         }
-                        // std::cout << "Low leaf hash " << low_leaf_hash.value() << std::endl;
-
-                        std::optional<IndexedLeafValueType> low_leaf_option =
-                            store_->get_leaf_by_hash(low_leaf_hash.value(), *tx, true);
+                    }
+                },
+                thread_heuristics::DB_LOOKUP_COST);
 
-                        if (!low_leaf_option.has_value()) {
-                            // std::cout << "No pre-image" << std::endl;
-                            throw std::runtime_error(format("Unable to insert values into tree ",
-                                                            meta.name,
-                                                            " failed to get leaf pre-image by hash for index ",
-                                                            low_leaf_index));
+            // The low leaf of a value is never greater than that of a greater value, so values that share a low leaf
+            // form runs. The pre-image of the low leaf of each run is fetched in parallel, then the values of a run
+            // are linked into the low leaf one after the other.
+            std::vector<size_t> run_starts;
+            for (size_t i = 0; i < values.size(); ++i) {
+                if (values[i].first.is_empty()) {
+                    continue;
+                }
+                if (run_starts.empty() || low_leaf_lookups[run_starts.back()].second != low_leaf_lookups[i].second) {
+                    run_starts.push_back(i);
+                }
+            }
+            struct LowLeafPreImage {
+                bool hash_found = true;
+                std::optional<IndexedLeafValueType> leaf;
+            };
+            std::vector<LowLeafPreImage> run_low_leaves(run_starts.size());
+            parallel_for_heuristic(
+                run_starts.size(),
+                [&](size_t start, size_t end, BB_UNUSED size_t chunk_index) {
+                    ReadTransactionPtr tx = store_->create_read_transaction();
+                    RequestContext chunkRequestContext = requestContext;
+                    chunkRequestContext.root = store_->get_current_root(*tx, true);
+                    for (size_t run = start; run < end; ++run) {
+                        index_t low_leaf_index = low_leaf_lookups[run_starts[run]].second;
+                        LowLeafPreImage& pre_image = run_low_leaves[run];
+                        // Try and retrieve the leaf pre-image from the cache first.
+                        // If unsuccessful, derive from the tree and hash based lookup
+                        pre_image.leaf = store_->get_cached_leaf_by_index(low_leaf_index);
+                        if (pre_image.leaf.has_value()) {
+                            continue;
+                        }
+                        std::optional<fr> low_leaf_hash =
+                            find_leaf_hash(low_leaf_index, chunkRequestContext, *tx, true);
+                        pre_image.hash_found = low_leaf_hash.has_value();
+                        if (pre_image.hash_found) {
+                            pre_image.leaf = store_->get_leaf_by_hash(low_leaf_hash.value(), *tx, true);
                         }
-                        // std::cout << "Low leaf pre-image " << low_leaf_option.value() << std::endl;
-                        low_leaf = low_leaf_option.value();
                     }
+                },
+                thread_heuristics::DB_LOOKUP_COST);
 
-                    LeafUpdate low_update = {
-                        .leaf_index = low_leaf_index,
-                        .updated_leaf = IndexedLeafValueType::empty(),
-                        .original_leaf = low_leaf,
-                    };
-
-                    // Capture the index and original value of the 'low' leaf
-
-                    if (!is_already_present) {
-                        // Update the current leaf to point it to the new leaf
-                        IndexedLeafValueType new_leaf =
-                            IndexedLeafValueType(value_pair.first, low_leaf.nextIndex, low_leaf.nextValue);
-
-                        low_leaf.nextIndex = index_of_new_leaf;
-                        low_leaf.nextValue = value;
-                        store_->set_leaf_key_at_index(index_of_new_leaf, new_leaf);
-
-                        // std::cout << "NEW LEAf TO BE INSERTED at index: " << index_of_new_leaf << " : " << new_leaf
-                        //           << std::endl;
-
-                        // std::cout << "Low leaf found at index " << low_leaf_index << " index of new leaf "
-                        //           << index_of_new_leaf << std::endl;
-
-                        store_->put_cached_leaf_by_index(low_leaf_index, low_leaf);
-                        // leaves_pre[low_leaf_index] = low_leaf;
-                        low_update.updated_leaf = low_leaf;
-
-                        // Update the set of leaves to append
-                        (*response.inner.leaves_to_append)[index_into_appended_leaves] = new_leaf;
-                    } else if (IndexedLeafValueType::is_updateable()) {
-                        // Update the current leaf's value, don't change it's link
-                        IndexedLeafValueType replacement_leaf =
-                            IndexedLeafValueType(value_pair.first, low_leaf.nextIndex, low_leaf.nextValue);
-                        // IndexedLeafValueType empty_leaf = IndexedLeafValueType::empty();
-                        //  don't update the index for this empty leaf
-                        // std::cout << "Low leaf updated at index " << low_leaf_index << " index of new leaf "
-                        //           << index_of_new_leaf << std::endl;
-                        // store_->set_leaf_key_at_index(index_of_new_leaf, empty_leaf);
-                        store_->put_cached_leaf_by_index(low_leaf_index, replacement_leaf);
-                        low_update.updated_leaf = replacement_leaf;
-                        // The set of appended leaves already has an empty leaf in the slot at index
-                        // 'index_into_appended_leaves'
-                    } else {
+            // Now that we have the low leaves we need to identify the leaves that need updating.
+            // This is performed sequentially and is stored in this 'leaf_update' struct
+            IndexedLeafValueType low_leaf;
+            size_t next_run = 0;
+            for (size_t i = 0; i < values.size(); ++i) {
+                std::pair<LeafValueType, size_t>& value_pair = values[i];
+                size_t index_into_appended_leaves = value_pair.second;
+                index_t index_of_new_leaf = static_cast<index_t>(index_into_appended_leaves) + meta.size;
+                if (value_pair.first.is_empty()) {
+                    continue;
+                }
+                fr value = value_pair.first.get_key();
+                auto [is_already_present, low_leaf_index] = low_leaf_lookups[i];
+
+                // The first value of a run starts from the pre-image fetched above, the following ones from the low
+                // leaf as updated by the previous value
+                if (next_run < run_starts.size() && run_starts[next_run] == i) {
+                    const LowLeafPreImage& pre_image = run_low_leaves[next_run++];
+                    if (!pre_image.hash_found) {
                         throw std::runtime_error(format("Unable to insert values into tree ",
                                                         meta.name,
-                                                        " leaf type ",
-                                                        IndexedLeafValueType::name(),
-                                                        " is not updateable and ",
-                                                        value_pair.first.get_key(),
-                                                        " is already present"));
+                                                        ", failed to find low leaf at index ",
+                                                        low_leaf_index,
+                                                        ", current size: ",
+                                                        meta.size));
+                    }
+                    if (!pre_image.leaf.has_value()) {
+                        throw std::runtime_error(format("Unable to insert values into tree ",
+                                                        meta.name,
+                                                        " failed to get leaf pre-image by hash for index ",
+                                                        low_leaf_index));
                     }
-                    response.inner.highest_index = std::max(response.inner.highest_index, low_leaf_index);
+                    low_leaf = pre_image.leaf.value();
+                }
+
+                LeafUpdate low_update = {
+                    .leaf_index = low_leaf_index,
+                    .updated_leaf = IndexedLeafValueType::empty(),
+                    .original_leaf = low_leaf,
+                };
+
+                // Capture the index and original value of the 'low' leaf
+
+                if (!is_already_present) {
+                    // Update the current leaf to point it to the new leaf
+                    IndexedLeafValueType new_leaf =
+                        IndexedLeafValueType(value_pair.first, low_leaf.nextIndex, low_leaf.nextValue);
+
+                    low_leaf.nextIndex = index_of_new_leaf;
+                    low_leaf.nextValue = value;
+                    store_->set_leaf_key_at_index(index_of_new_leaf, new_leaf);
+
+                    store_->put_cached_leaf_by_index(low_leaf_index, low_leaf);
+                    low_update.updated_leaf = low_leaf;
 
-                    response.inner.low_leaf_updates->push_back(low_update);
+                    // Update the set of leaves to append
+                    (*response.inner.leaves_to_append)[index_into_appended_leaves] = new_leaf;
+                } else if (IndexedLeafValueType::is_updateable()) {
+                    // Update the current leaf's value, don't change it's link
+                    IndexedLeafValueType replacement_leaf =
+                        IndexedLeafValueType(value_pair.first, low_leaf.nextIndex, low_leaf.nextValue);
+                    store_->put_cached_leaf_by_index(low_leaf_index, replacement_leaf);
+                    low_update.updated_leaf = replacement_leaf;
+                    low_leaf = replacement_leaf;
+                    // The set of appended leaves already has an empty leaf in the slot at index
+                    // 'index_into_appended_leaves'
+                } else {
+                    throw std::runtime_error(format("Unable to insert values into tree ",
+                                                    meta.name,
+                                                    " leaf type ",
+                                                    IndexedLeafValueType::name(),
+                                                    " is not updateable and ",
+                                                    value_pair.first.get_key(),
+                                                    " is already present"));
                 }
+                response.inner.highest_index = std::max(response.inner.highest_index, low_leaf_index);
+
+                response.inner.low_leaf_updates->push_back(low_update);
             }
         },
         on_completion);
@@ -1168,7 +1203,8 @@ void ContentAddressedIndexedTree<Store, HashingPolicy>::sparse_batch_update(
     std::unordered_set<index_t> unique_indices;
     while (level > 0) {
         std::vector<index_t> next_indices;
-        std::unordered_map<index_t, fr> next_hashes;
+        std::vector<std::pair<std::optional<fr>, std::optional<fr>>> children;
+        std::vector<fr> hash_inputs;
         for (size_t i = 0; i < indices.size(); ++i) {
             index_t index = indices[i];
             index_t parent_index = index >> 1;
@@ -1183,11 +1219,20 @@ void ContentAddressedIndexedTree<Store, HashingPolicy>::sparse_batch_update(
             std::optional<fr> new_left_option = is_right ? get_optional_node(level, index - 1) : new_hash;
             fr new_right_value = new_right_option.has_value() ? new_right_option.value() : zero_hashes_[level];
             fr new_left_value = new_left_option.has_value() ? new_left_option.value() : zero_hashes_[level];
-
-            new_hash = HashingPolicy::hash_pair(new_left_value, new_right_value);
-            store_->put_cached_node_by_index(level - 1, parent_index, new_hash);
+            children.emplace_back(new_left_option, new_right_option);
+            hash_inputs.push_back(new_left_value);
+            hash_inputs.push_back(new_right_value);
+        }
+        // Hash all the new nodes of the level above in one batch
+        std::vector<fr> parent_hashes(next_indices.size());
+        HashingPolicy::hash_pairs(hash_inputs, parent_hashes);
+        std::unordered_map<index_t, fr> next_hashes;
+        for (size_t i = 0; i < next_indices.size(); ++i) {
+            const auto& [new_left_option, new_right_option] = children[i];
+            const fr& new_hash = parent_hashes[i];
+            store_->put_cached_node_by_index(level - 1, next_indices[i], new_hash);
             store_->put_node_by_hash(new_hash, { .left = new_left_option, .right = new_right_option, .ref = 1 });
-            next_hashes[parent_index] = new_hash;
+            next_hashes[next_indices[i]] = new_hash;
         }
         indices = std::move(next_indices);
         hashes = std::move(next_hashes);
@@ -1252,7 +1297,8 @@ std::pair<bool, fr> ContentAddressedIndexedTree<Store, HashingPolicy>::sparse_ba
 
     while (level > root_level) {
         std::vector<index_t> next_indices;
-        std::unordered_map<index_t, fr> next_hashes;
+        std::vector<std::pair<std::optional<fr>, std::optional<fr>>> children;
+        std::vector<fr> hash_inputs;
         for (size_t i = 0; i < indices.size(); ++i) {
             index_t index = indices[i];
             index_t parent_index = index >> 1;
@@ -1267,13 +1313,20 @@ std::pair<bool, fr> ContentAddressedIndexedTree<Store, HashingPolicy>::sparse_ba
             std::optional<fr> new_left_option = is_right ? get_optional_node(level, index - 1) : new_hash;
             fr new_right_value = new_right_option.has_value() ? new_right_option.value() : zero_hashes_[level];
             fr new_left_value = new_left_option.has_value() ? new_left_option.value() : zero_hashes_[level];
-
-            new_hash = HashingPolicy::hash_pair(new_left_value, new_right_value);
-            store_->put_cached_node_by_index(level - 1, parent_index, new_hash);
+            children.emplace_back(new_left_option, new_right_option);
+            hash_inputs.push_back(new_left_value);
+            hash_inputs.push_back(new_right_value);
+        }
+        // Hash all the new nodes of the level above in one batch
+        std::vector<fr> parent_hashes(next_indices.size());
+        HashingPolicy::hash_pairs(hash_inputs, parent_hashes);
+        std::unordered_map<index_t, fr> next_hashes;
+        for (size_t i = 0; i < next_indices.size(); ++i) {
+            const auto& [new_left_option, new_right_option] = children[i];
+            new_hash = parent_hashes[i];
+            store_->put_cached_node_by_index(level - 1, next_indices[i], new_hash);
             store_->put_node_by_hash(new_hash, { .left = new_left_option, .right = new_right_option, .ref = 1 });
-            next_hashes[parent_index] = new_hash;
-            // std::cout << "Created parent hash at level " << level - 1 << " index " << parent_index << " hash "
-            //           << new_hash << " left " << new_left_value << " right " << new_right_value << std::endl;
+            next_hashes[next_indices[i]] = new_hash;
         }
         indices = std::move(next_indices);
         hashes = std::move(next_hashes);
@@ -0,0 +1,138 @@
+#pragma once
+#include "barretenberg/common/ankerl_dense.hpp"
+#include "barretenberg/crypto/merkle_tree/types.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+namespace bb::crypto::merkle_tree {
+
+/**
+ * @brief A bounded, thread safe cache of decoded data read from the committed state of a tree, keyed by hash
+ *
+ * @details Nodes and leaf pre-images are content addressed, so the data stored under a hash only changes when a write
+ * transaction updates its reference count or deletes it. Writes invalidate the hash, and values are only added from
+ * read transactions whose snapshot contains every invalidating write, so a value read from an older snapshot (or while
+ * a write is still in progress) can not be added after the write removed it.
+ *
+ * The cache is split into shards, each holding two generations of entries: once the current generation of a shard is
+ * full it replaces the previous one, and entries of the previous generation are moved back into the current one when
+ * they are read. This bounds the size of the cache to twice its capacity and keeps the entries in use.
+ */
+template <typename Value> class CommittedDataCache {
+  public:
+    static constexpr size_t NUM_SHARDS = 16;
+
+    explicit CommittedDataCache(size_t capacity)
+        : shard_capacity_(std::max(capacity / NUM_SHARDS, static_cast<size_t>(1)))
+    {}
+
+    bool get(const fr& hash, Value& value)
+    {
+        Shard& shard = get_shard(hash);
+        std::unique_lock lock(shard.mutex);
+        auto it = shard.current.find(hash);
+        if (it != shard.current.end()) {
+            value = it->second;
+            return true;
+        }
+        it = shard.previous.find(hash);
+        if (it == shard.previous.end()) {
+            return false;
+        }
+        value = it->second;
+        insert(shard, hash, value);
+        return true;
+    }
+
+    /**
+     * @brief Adds a value read from the committed state by a read transaction with the given snapshot id
+     */
+    void put(const fr& hash, const Value& value, uint64_t snapshot_id)
+    {
+        Shard& shard = get_shard(hash);
+        std::unique_lock lock(shard.mutex);
+        if (snapshot_id < min_snapshot_id_.load()) {
+            return;
+        }
+        insert(shard, hash, value);
+    }
+
+    /**
+     * @brief Removes the value of a hash written or deleted by the write transaction with the given id
+     *
+     * @return The previous minimum snapshot id if this raised it to write_id, i.e. on the first invalidation of the
+     * write. Pass it to abort_write if the write transaction is aborted.
+     */
+    std::optional<uint64_t> invalidate(const fr& hash, uint64_t write_id)
+    {
+        // Raised before the entry is removed, so that a concurrent put of a value read from an older snapshot either
+        // happens before the removal or is rejected
+        std::optional<uint64_t> previous;
+        uint64_t current = min_snapshot_id_.load();
+        while (current < write_id) {
+            if (min_snapshot_id_.compare_exchange_weak(current, write_id)) {
+                previous = current;
+                break;
+            }
+        }
+        Shard& shard = get_shard(hash);
+        std::unique_lock lock(shard.mutex);
+        shard.current.erase(hash);
+        shard.previous.erase(hash);
+        return previous;
+    }
+
+    /**
+     * @brief Lowers the minimum snapshot id back to its value before an aborted write
+     * @details The aborted write changed nothing, so values read from the snapshots it rejected are valid again. The
+     * hashes it invalidated stay removed, which is harmless.
+     */
+    void abort_write(uint64_t write_id, uint64_t previous_min_snapshot_id)
+    {
+        min_snapshot_id_.compare_exchange_strong(write_id, previous_min_snapshot_id);
+    }
+
+    size_t size() const
+    {
+        size_t size = 0;
+        for (const Shard& shard : shards_) {
+            std::unique_lock lock(shard.mutex);
+            size += shard.current.size() + shard.previous.size();
+        }
+        return size;
+    }
+
+  private:
+    using Map = ankerl::unordered_dense::map<fr, Value, TreeKeyHash>;
+
+    struct Shard {
+        mutable std::mutex mutex;
+        Map current;
+        Map previous;
+    };
+
+    Shard& get_shard(const fr& hash) { return shards_[TreeKeyHash{}(hash) % NUM_SHARDS]; }
+
+    void insert(Shard& shard, const fr& hash, const Value& value)
+    {
+        if (shard.current.size() >= shard_capacity_) {
+            shard.previous = std::move(shard.current);
+            shard.current = Map{};
+        }
+        shard.current.insert_or_assign(hash, value);
+    }
+
+    size_t shard_capacity_;
+    std::array<Shard, NUM_SHARDS> shards_;
+    // Values read from snapshots older than this may have been changed by a write
+    std::atomic<uint64_t> min_snapshot_id_ = 0;
+};
+
+} // namespace bb::crypto::merkle_tree
@@ -0,0 +1,77 @@
+#include "barretenberg/crypto/merkle_tree/lmdb_store/committed_data_cache.hpp"
+#include "barretenberg/common/test.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+#include <cstdint>
+
+using namespace bb;
+using namespace bb::crypto::merkle_tree;
+
+namespace {
+auto& engine = numeric::get_debug_randomness();
+} // namespace
+
+TEST(CommittedDataCache, RejectsValuesFromSnapshotsOlderThanAWrite)
+{
+    CommittedDataCache<uint64_t> cache(1024);
+    fr hash = fr::random_element(&engine);
+    uint64_t value = 0;
+
+    cache.put(hash, 1, 5);
+    EXPECT_TRUE(cache.get(hash, value));
+    EXPECT_EQ(value, 1);
+
+    // A write transaction that will become commit 6 changes the value
+    cache.invalidate(hash, 6);
+    EXPECT_FALSE(cache.get(hash, value));
+
+    // A reader that started before the write was committed read the old value, which must not be cached
+    cache.put(hash, 1, 5);
+    EXPECT_FALSE(cache.get(hash, value));
+
+    // Readers of the new commit can fill the cache again
+    cache.put(hash, 2, 6);
+    EXPECT_TRUE(cache.get(hash, value));
+    EXPECT_EQ(value, 2);
+
+    // The same holds for the other hashes
+    fr other_hash = fr::random_element(&engine);
+    cache.put(other_hash, 3, 5);
+    EXPECT_FALSE(cache.get(other_hash, value));
+}
+
+TEST(CommittedDataCache, AbortedWriteDoesNotRejectValues)
+{
+    CommittedDataCache<uint64_t> cache(1024);
+    fr hash = fr::random_element(&engine);
+    fr other_hash = fr::random_element(&engine);
+    uint64_t value = 0;
+
+    // Only the first invalidation of a write raises the minimum snapshot id
+    const auto previous = cache.invalidate(hash, 6);
+    ASSERT_TRUE(previous.has_value());
+    EXPECT_EQ(*previous, 0);
+    EXPECT_FALSE(cache.invalidate(other_hash, 6).has_value());
+
+    // The write is aborted, so the committed state of snapshot 5 is still current
+    cache.abort_write(6, *previous);
+    cache.put(hash, 1, 5);
+    EXPECT_TRUE(cache.get(hash, value));
+    EXPECT_EQ(value, 1);
+}
+
+TEST(CommittedDataCache, IsBoundedAndKeepsRecentlyReadValues)
+{
+    constexpr size_t capacity = 16 * CommittedDataCache<uint64_t>::NUM_SHARDS;
+    CommittedDataCache<uint64_t> cache(capacity);
+    fr hot_hash = fr::random_element(&engine);
+    cache.put(hot_hash, 0, 0);
+
+    for (uint64_t i = 1; i < 100 * capacity; i++) {
+        cache.put(fr::random_element(&engine), i, 0);
+        EXPECT_LE(cache.size(), 2 * capacity);
+        // Reading the value moves it back to the current generation of its shard
+        uint64_t value = 1;
+        EXPECT_TRUE(cache.get(hot_hash, value));
+        EXPECT_EQ(value, 0);
+    }
+}
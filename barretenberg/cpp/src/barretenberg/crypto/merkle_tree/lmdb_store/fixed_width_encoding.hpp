@@ -0,0 +1,111 @@
+#pragma once
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/common/serialize.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include "barretenberg/serialize/cbind.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * Versioned, fixed layout binary encoding of the values held in the tree databases.
+ *
+ * A value starts with a marker byte, followed by the version of the layout. Its fields
+ * follow in declaration order with fixed widths: integers as 8 bytes and field elements as 32 bytes, both big endian,
+ * and optional field elements as a presence byte followed by 32 bytes (zero when absent). Values are decoded in place
+ * from the LMDB page, without going through an intermediate msgpack object.
+ *
+ * Introducing this encoding bumped WORLD_STATE_DB_VERSION (yarn-project/world-state), so databases holding msgpack
+ * values are reset rather than read.
+ */
+namespace bb::crypto::merkle_tree::fixed_width_encoding {
+
+// Never the first byte of a msgpack value, so a value with another encoding is rejected
+constexpr uint8_t MARKER = 0xc1;
+constexpr uint8_t VERSION = 1;
+constexpr size_t HEADER_SIZE = 2;
+
+inline void write_field(std::vector<uint8_t>& buf, const fr& value)
+{
+    write(buf, value);
+}
+
+inline void write_field(std::vector<uint8_t>& buf, uint64_t value)
+{
+    serialize::write(buf, value);
+}
+
+inline void write_field(std::vector<uint8_t>& buf, const std::optional<fr>& value)
+{
+    serialize::write(buf, static_cast<uint8_t>(value.has_value()));
+    write_field(buf, value.value_or(fr::zero()));
+}
+
+template <msgpack_concepts::HasMsgPack T> void write_field(std::vector<uint8_t>& buf, const T& value)
+{
+    msgpack::msgpack_apply(value, [&](const auto&... fields) { (write_field(buf, fields), ...); });
+}
+
+// Consumes the next size bytes of the value
+inline const uint8_t* take(std::span<const uint8_t>& data, size_t size)
+{
+    if (data.size() < size) {
+        throw std::runtime_error("Truncated value in tree database");
+    }
+    const uint8_t* it = data.data();
+    data = data.subspan(size);
+    return it;
+}
+
+inline void read_field(std::span<const uint8_t>& data, fr& value)
+{
+    const uint8_t* it = take(data, sizeof(fr));
+    read(it, value);
+}
+
+inline void read_field(std::span<const uint8_t>& data, uint64_t& value)
+{
+    const uint8_t* it = take(data, sizeof(uint64_t));
+    serialize::read(it, value);
+}
+
+inline void read_field(std::span<const uint8_t>& data, std::optional<fr>& value)
+{
+    bool has_value = *take(data, 1) != 0;
+    fr field;
+    read_field(data, field);
+    value = has_value ? std::optional<fr>(field) : std::nullopt;
+}
+
+template <msgpack_concepts::HasMsgPack T> void read_field(std::span<const uint8_t>& data, T& value)
+{
+    msgpack::msgpack_apply(value, [&](auto&... fields) { (read_field(data, fields), ...); });
+}
+
+template <typename T> std::vector<uint8_t> encode(const T& value)
+{
+    std::vector<uint8_t> buf{ MARKER, VERSION };
+    write_field(buf, value);
+    return buf;
+}
+
+template <typename T> void decode(std::span<const uint8_t> data, T& value)
+{
+    if (data.empty() || data[0] != MARKER) {
+        throw std::runtime_error("Tree database value does not have the fixed width encoding");
+    }
+    if (data.size() < HEADER_SIZE || data[1] != VERSION) {
+        throw std::runtime_error(format("Unsupported version of tree database value encoding: ",
+                                        data.size() < HEADER_SIZE ? 0 : static_cast<uint32_t>(data[1])));
+    }
+    data = data.subspan(HEADER_SIZE);
+    read_field(data, value);
+    if (!data.empty()) {
+        throw std::runtime_error(format("Unexpected ", data.size(), " trailing bytes in tree database value"));
+    }
+}
+
+} // namespace bb::crypto::merkle_tree::fixed_width_encoding
@@ -0,0 +1,80 @@
+#include "barretenberg/crypto/merkle_tree/lmdb_store/fixed_width_encoding.hpp"
+#include "barretenberg/common/test.hpp"
+#include "barretenberg/crypto/merkle_tree/indexed_tree/indexed_leaf.hpp"
+#include "barretenberg/crypto/merkle_tree/lmdb_store/lmdb_tree_store.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+#include <cstdint>
+#include <vector>
+
+using namespace bb;
+using namespace bb::crypto::merkle_tree;
+
+namespace {
+auto& engine = numeric::get_debug_randomness();
+
+template <typename T> T round_trip(const T& value)
+{
+    std::vector<uint8_t> encoded = fixed_width_encoding::encode(value);
+    T decoded;
+    fixed_width_encoding::decode(encoded, decoded);
+    return decoded;
+}
+
+template <typename T> std::vector<uint8_t> pack_msgpack(const T& value)
+{
+    msgpack::sbuffer buffer;
+    msgpack::pack(buffer, value);
+    return { buffer.data(), buffer.data() + buffer.size() };
+}
+} // namespace
+
+TEST(FixedWidthEncoding, NodesHaveAFixedSize)
+{
+    NodePayload node{ .left = fr::random_element(&engine), .right = fr::random_element(&engine), .ref = 3 };
+    NodePayload empty_node{ .left = std::nullopt, .right = std::nullopt, .ref = 1 };
+
+    EXPECT_EQ(fixed_width_encoding::encode(node).size(), fixed_width_encoding::HEADER_SIZE + 2 * 33 + 8);
+    EXPECT_EQ(fixed_width_encoding::encode(empty_node).size(), fixed_width_encoding::encode(node).size());
+    EXPECT_EQ(round_trip(node), node);
+    EXPECT_EQ(round_trip(empty_node), empty_node);
+}
+
+TEST(FixedWidthEncoding, RoundTripsBlocksAndLeaves)
+{
+    BlockPayload block{ .size = 1024, .blockNumber = 7, .root = fr::random_element(&engine) };
+    EXPECT_EQ(round_trip(block), block);
+
+    IndexedLeaf<NullifierLeafValue> nullifier(
+        NullifierLeafValue(fr::random_element(&engine)), 12, fr::random_element(&engine));
+    EXPECT_EQ(round_trip(nullifier), nullifier);
+
+    IndexedLeaf<PublicDataLeafValue> public_data(
+        PublicDataLeafValue(fr::random_element(&engine), fr::random_element(&engine)), 5, fr::random_element(&engine));
+    EXPECT_EQ(fixed_width_encoding::encode(public_data).size(), fixed_width_encoding::HEADER_SIZE + 3 * 32 + 8);
+    EXPECT_EQ(round_trip(public_data), public_data);
+}
+
+TEST(FixedWidthEncoding, RejectsMsgpackValues)
+{
+    NodePayload node{ .left = fr::random_element(&engine), .right = std::nullopt, .ref = 2 };
+    NodePayload decoded;
+    EXPECT_THROW(fixed_width_encoding::decode(pack_msgpack(node), decoded), std::runtime_error);
+}
+
+TEST(FixedWidthEncoding, RejectsUnknownVersionsAndTruncatedValues)
+{
+    BlockPayload block{ .size = 1, .blockNumber = 1, .root = fr::random_element(&engine) };
+    std::vector<uint8_t> encoded = fixed_width_encoding::encode(block);
+    BlockPayload decoded;
+
+    std::vector<uint8_t> future = encoded;
+    future[1] = fixed_width_encoding::VERSION + 1;
+    EXPECT_THROW(fixed_width_encoding::decode(future, decoded), std::runtime_error);
+
+    std::vector<uint8_t> truncated(encoded.begin(), encoded.end() - 1);
+    EXPECT_THROW(fixed_width_encoding::decode(truncated, decoded), std::runtime_error);
+
+    std::vector<uint8_t> extended = encoded;
+    extended.push_back(0);
+    EXPECT_THROW(fixed_width_encoding::decode(extended, decoded), std::runtime_error);
+}
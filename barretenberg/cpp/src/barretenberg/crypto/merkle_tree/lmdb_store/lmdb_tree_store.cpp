@@ -17,6 +17,7 @@
 #include <lmdb.h>
 #include <optional>
 #include <stdexcept>
+#include <tuple>
 #include <unordered_map>
 #include <vector>
 
@@ -48,9 +49,16 @@ int index_key_cmp(const MDB_val* a, const MDB_val* b)
     return value_cmp<uint64_t>(a, b);
 }
 
-LMDBTreeStore::LMDBTreeStore(std::string directory, std::string name, uint64_t mapSizeKb, uint64_t maxNumReaders)
+LMDBTreeStore::LMDBTreeStore(std::string directory,
+                             std::string name,
+                             uint64_t mapSizeKb,
+                             uint64_t maxNumReaders,
+                             size_t nodeCacheCapacity,
+                             size_t leafCacheCapacity)
     : LMDBStoreBase(directory, mapSizeKb, maxNumReaders, 5)
     , _name(std::move(name))
+    , _nodeCache(nodeCacheCapacity)
+    , _leafCaches(leafCacheCapacity, leafCacheCapacity)
 {
 
     {
@@ -103,9 +111,7 @@ void LMDBTreeStore::write_block_data(const block_number_t& blockNumber,
                                      const BlockPayload& blockData,
                                      LMDBTreeStore::WriteTransaction& tx)
 {
-    msgpack::sbuffer buffer;
-    msgpack::pack(buffer, blockData);
-    std::vector<uint8_t> encoded(buffer.data(), buffer.data() + buffer.size());
+    std::vector<uint8_t> encoded = fixed_width_encoding::encode(blockData);
     BlockMetaKeyType key(blockNumber);
     tx.put_value<BlockMetaKeyType>(key, encoded, *_blockDatabase);
 }
@@ -121,10 +127,10 @@ bool LMDBTreeStore::read_block_data(const block_number_t& blockNumber,
                                     LMDBTreeStore::ReadTransaction& tx)
 {
     BlockMetaKeyType key(blockNumber);
-    std::vector<uint8_t> data;
+    ValueView data;
     bool success = tx.get_value<BlockMetaKeyType>(key, data, *_blockDatabase);
     if (success) {
-        msgpack::unpack((const char*)data.data(), data.size()).get().convert(blockData);
+        fixed_width_encoding::decode(data, blockData);
     }
     return success;
 }
@@ -269,6 +275,7 @@ void LMDBTreeStore::decrement_node_reference_count(const fr& nodeHash, NodePaylo
     }
     if (--nodeData.ref == 0) {
         // std::cout << "Deleting node at " << nodeHash << std::endl;
+        invalidate(_nodeCache, nodeHash, tx);
         tx.delete_value(nodeHash, *_nodeDatabase);
         return;
     }
@@ -278,6 +285,8 @@ void LMDBTreeStore::decrement_node_reference_count(const fr& nodeHash, NodePaylo
 
 void LMDBTreeStore::delete_leaf_by_hash(const fr& leafHash, WriteTransaction& tx)
 {
+    // The type of the deleted pre-image is unknown here
+    std::apply([&](auto&... caches) { (invalidate(caches, leafHash, tx), ...); }, _leafCaches);
     FrKeyType key(leafHash);
     tx.delete_value(key, *_leafHashToPreImageDatabase);
 }
@@ -303,22 +312,29 @@ fr LMDBTreeStore::find_low_leaf(const fr& leafValue,
 
 bool LMDBTreeStore::read_node(const fr& nodeHash, NodePayload& nodeData, ReadTransaction& tx)
 {
+    if (_nodeCache.get(nodeHash, nodeData)) {
+        return true;
+    }
     FrKeyType key(nodeHash);
-    std::vector<uint8_t> data;
+    ValueView data;
     bool success = tx.get_value<FrKeyType>(key, data, *_nodeDatabase);
     if (success) {
-        msgpack::unpack((const char*)data.data(), data.size()).get().convert(nodeData);
+        fixed_width_encoding::decode(data, nodeData);
+        _nodeCache.put(nodeHash, nodeData, get_snapshot_id(tx));
     }
     return success;
 }
 
 void LMDBTreeStore::write_node(const fr& nodeHash, const NodePayload& nodeData, WriteTransaction& tx)
 {
-    msgpack::sbuffer buffer;
-    msgpack::pack(buffer, nodeData);
-    std::vector<uint8_t> encoded(buffer.data(), buffer.data() + buffer.size());
+    invalidate(_nodeCache, nodeHash, tx);
+    std::vector<uint8_t> encoded = fixed_width_encoding::encode(nodeData);
     FrKeyType key(nodeHash);
     tx.put_value<FrKeyType>(key, encoded, *_nodeDatabase);
 }
 
-} // namespace bb::crypto::merkle_tree
\ No newline at end of file
+uint64_t LMDBTreeStore::get_snapshot_id(const LMDBTransaction& tx)
+{
+    return static_cast<uint64_t>(mdb_txn_id(tx.underlying()));
+}
+} // namespace bb::crypto::merkle_tree
@@ -2,6 +2,8 @@
 #include "barretenberg/common/log.hpp"
 #include "barretenberg/common/serialize.hpp"
 #include "barretenberg/crypto/merkle_tree/indexed_tree/indexed_leaf.hpp"
+#include "barretenberg/crypto/merkle_tree/lmdb_store/committed_data_cache.hpp"
+#include "barretenberg/crypto/merkle_tree/lmdb_store/fixed_width_encoding.hpp"
 #include "barretenberg/crypto/merkle_tree/node_store/tree_meta.hpp"
 #include "barretenberg/crypto/merkle_tree/types.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
@@ -14,11 +16,13 @@
 #include "barretenberg/world_state/types.hpp"
 #include "lmdb.h"
 #include <cstdint>
+#include <memory>
 #include <optional>
 #include <ostream>
 #include <stdexcept>
 #include <string>
-#include <typeinfo>
+#include <tuple>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 
@@ -164,7 +168,17 @@ class LMDBTreeStore : public LMDBStoreBase {
     using SharedPtr = std::shared_ptr<LMDBTreeStore>;
     using ReadTransaction = LMDBReadTransaction;
     using WriteTransaction = LMDBWriteTransaction;
-    LMDBTreeStore(std::string directory, std::string name, uint64_t mapSizeKb, uint64_t maxNumReaders);
+
+    // Default number of decoded nodes and leaf pre-images kept in memory for all the forks of the tree
+    static constexpr size_t DEFAULT_NODE_CACHE_CAPACITY = 1 << 16;
+    static constexpr size_t DEFAULT_LEAF_CACHE_CAPACITY = 1 << 14;
+
+    LMDBTreeStore(std::string directory,
+                  std::string name,
+                  uint64_t mapSizeKb,
+                  uint64_t maxNumReaders,
+                  size_t nodeCacheCapacity = DEFAULT_NODE_CACHE_CAPACITY,
+                  size_t leafCacheCapacity = DEFAULT_LEAF_CACHE_CAPACITY);
     LMDBTreeStore(const LMDBTreeStore& other) = delete;
     LMDBTreeStore(LMDBTreeStore&& other) = delete;
     LMDBTreeStore& operator=(const LMDBTreeStore& other) = delete;
@@ -238,7 +252,24 @@ class LMDBTreeStore : public LMDBStoreBase {
     LMDBDatabase::Ptr _leafHashToPreImageDatabase;
     LMDBDatabase::Ptr _indexToBlockDatabase;
 
+    // Committed data decoded by read transactions, shared by every fork of the tree as they share this store.
+    // Leaf pre-images are cached for the leaf types of the indexed trees, other leaf types are always decoded.
+    CommittedDataCache<NodePayload> _nodeCache;
+    std::tuple<CommittedDataCache<IndexedLeaf<NullifierLeafValue>>,
+               CommittedDataCache<IndexedLeaf<PublicDataLeafValue>>>
+        _leafCaches;
+
+    template <typename LeafType>
+    static constexpr bool is_cached_leaf_v = std::is_same_v<LeafType, IndexedLeaf<NullifierLeafValue>> ||
+                                             std::is_same_v<LeafType, IndexedLeaf<PublicDataLeafValue>>;
+
     template <typename TxType> bool get_node_data(const fr& nodeHash, NodePayload& nodeData, TxType& tx);
+
+    // Removes a value written or deleted by the transaction from a cache, restoring the cache if the write is aborted
+    template <typename Value> void invalidate(CommittedDataCache<Value>& cache, const fr& hash, WriteTransaction& tx);
+
+    // The id of the latest commit visible to a read transaction, or of the commit a write transaction will make
+    static uint64_t get_snapshot_id(const LMDBTransaction& tx);
 };
 
 template <typename TxType> bool LMDBTreeStore::read_leaf_index(const fr& leafValue, index_t& leafIndex, TxType& tx)
@@ -250,11 +281,21 @@ template <typename TxType> bool LMDBTreeStore::read_leaf_index(const fr& leafVal
 template <typename LeafType, typename TxType>
 bool LMDBTreeStore::read_leaf_by_hash(const fr& leafHash, LeafType& leafData, TxType& tx)
 {
+    // Write transactions read their own uncommitted changes, so they bypass the cache
+    constexpr bool use_cache = std::is_same_v<TxType, ReadTransaction> && is_cached_leaf_v<LeafType>;
+    if constexpr (use_cache) {
+        if (std::get<CommittedDataCache<LeafType>>(_leafCaches).get(leafHash, leafData)) {
+            return true;
+        }
+    }
     FrKeyType key(leafHash);
-    std::vector<uint8_t> data;
+    ValueView data;
     bool success = tx.template get_value<FrKeyType>(key, data, *_leafHashToPreImageDatabase);
     if (success) {
-        msgpack::unpack((const char*)data.data(), data.size()).get().convert(leafData);
+        fixed_width_encoding::decode(data, leafData);
+        if constexpr (use_cache) {
+            std::get<CommittedDataCache<LeafType>>(_leafCaches).put(leafHash, leafData, get_snapshot_id(tx));
+        }
     }
     return success;
 }
@@ -262,20 +303,32 @@ bool LMDBTreeStore::read_leaf_by_hash(const fr& leafHash, LeafType& leafData, Tx
 template <typename LeafType>
 void LMDBTreeStore::write_leaf_by_hash(const fr& leafHash, const LeafType& leafData, WriteTransaction& tx)
 {
-    msgpack::sbuffer buffer;
-    msgpack::pack(buffer, leafData);
-    std::vector<uint8_t> encoded(buffer.data(), buffer.data() + buffer.size());
+    if constexpr (is_cached_leaf_v<LeafType>) {
+        invalidate(std::get<CommittedDataCache<LeafType>>(_leafCaches), leafHash, tx);
+    }
+    std::vector<uint8_t> encoded = fixed_width_encoding::encode(leafData);
     FrKeyType key(leafHash);
     tx.put_value<FrKeyType>(key, encoded, *_leafHashToPreImageDatabase);
 }
 
+template <typename Value>
+void LMDBTreeStore::invalidate(CommittedDataCache<Value>& cache, const fr& hash, WriteTransaction& tx)
+{
+    const uint64_t writeId = get_snapshot_id(tx);
+    std::optional<uint64_t> previous = cache.invalidate(hash, writeId);
+    if (previous.has_value()) {
+        // An aborted write changes nothing, so the values it made the cache reject are valid again
+        tx.on_abort([&cache, writeId, previous = previous.value()]() { cache.abort_write(writeId, previous); });
+    }
+}
+
 template <typename TxType> bool LMDBTreeStore::get_node_data(const fr& nodeHash, NodePayload& nodeData, TxType& tx)
 {
     FrKeyType key(nodeHash);
-    std::vector<uint8_t> data;
+    ValueView data;
     bool success = tx.template get_value<FrKeyType>(key, data, *_nodeDatabase);
     if (success) {
-        msgpack::unpack((const char*)data.data(), data.size()).get().convert(nodeData);
+        fixed_width_encoding::decode(data, nodeData);
     }
     return success;
 }
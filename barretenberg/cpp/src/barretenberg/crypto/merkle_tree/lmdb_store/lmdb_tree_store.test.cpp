@@ -300,6 +300,38 @@ TEST_F(LMDBTreeStoreTest, can_write_and_read_leaves_by_hash)
     }
 }
 
+TEST_F(LMDBTreeStoreTest, aborted_writes_leave_committed_leaves_readable)
+{
+    using LeafType = IndexedLeaf<PublicDataLeafValue>;
+    LeafType leafData(PublicDataLeafValue(VALUES[0], VALUES[1]), 3, VALUES[2]);
+    bb::fr key = VALUES[3];
+    LMDBTreeStore store(_directory, "DB1", _mapSize, _maxReaders, 16, 16);
+    {
+        LMDBWriteTransaction::Ptr transaction = store.create_write_transaction();
+        store.write_leaf_by_hash(key, leafData, *transaction);
+        transaction->commit();
+    }
+
+    // Overwritten and deleted by writes that are then aborted
+    {
+        LMDBWriteTransaction::Ptr transaction = store.create_write_transaction();
+        store.write_leaf_by_hash(key, LeafType(PublicDataLeafValue(VALUES[0], VALUES[4]), 5, VALUES[6]), *transaction);
+        transaction->abort();
+    }
+    {
+        LMDBWriteTransaction::Ptr transaction = store.create_write_transaction();
+        store.delete_leaf_by_hash(key, *transaction);
+    }
+
+    // Read twice, the second read being served from the cache
+    for (size_t i = 0; i < 2; ++i) {
+        LMDBReadTransaction::Ptr transaction = store.create_read_transaction();
+        LeafType readBack;
+        EXPECT_TRUE(store.read_leaf_by_hash(key, readBack, *transaction));
+        EXPECT_EQ(readBack, leafData);
+    }
+}
+
 TEST_F(LMDBTreeStoreTest, can_write_and_retrieve_block_numbers_by_index)
 {
     struct BlockAndIndex {
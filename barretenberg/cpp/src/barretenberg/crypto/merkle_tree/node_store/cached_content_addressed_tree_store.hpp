@@ -12,6 +12,7 @@
 #include "barretenberg/serialize/msgpack.hpp"
 #include "barretenberg/stdlib/primitives/field/field.hpp"
 #include "msgpack/assert.hpp"
+#include <condition_variable>
 #include <cstdint>
 #include <exception>
 #include <iostream>
@@ -40,7 +41,28 @@ template <typename LeafValueType> class ContentAddressedCachedTreeStore {
     using PersistedStoreType = LMDBTreeStore;
     using LeafType = LeafValueType;
     using IndexedLeafValueType = IndexedLeaf<LeafValueType>;
-    using ReadTransaction = typename PersistedStoreType::ReadTransaction;
+
+  private:
+    struct FrozenBlock;
+
+  public:
+    /**
+     * @brief A read transaction against the underlying store
+     * @details Holds on to the block committed by freeze_block as of when the transaction was opened, as the store
+     * seen by the transaction may not contain it, even once written.
+     */
+    class ReadTransaction : public PersistedStoreType::ReadTransaction {
+      public:
+        ReadTransaction(lmdblib::LMDBEnvironment::SharedPtr env, std::shared_ptr<const FrozenBlock> frozen)
+            : PersistedStoreType::ReadTransaction(std::move(env))
+            , frozen_(std::move(frozen))
+        {}
+
+        const FrozenBlock* get_frozen_block() const { return frozen_.get(); }
+
+      private:
+        std::shared_ptr<const FrozenBlock> frozen_;
+    };
     using WriteTransaction = typename PersistedStoreType::WriteTransaction;
     using ReadTransactionPtr = std::unique_ptr<ReadTransaction>;
     using WriteTransactionPtr = std::unique_ptr<WriteTransaction>;
@@ -145,13 +167,27 @@ template <typename LeafValueType> class ContentAddressedCachedTreeStore {
      */
     void commit_block(TreeMeta& finalMeta, TreeDBStats& dbStats);
 
+    /**
+     * @brief Commits the uncommitted data as a new block in memory, to be written by persist_frozen_block
+     * @details The block is read as committed data from here on and new data can be added on top of it straight away.
+     * Only one block is written at a time, so this waits for the write of the previous block.
+     */
+    void freeze_block(TreeMeta& finalMeta);
+
+    /**
+     * @brief Writes the block committed by freeze_block to the underlying store, can run alongside reads and writes of
+     * uncommitted data. If this fails, the next operation that writes to the underlying store throws the same error
+     * and returns the tree to its persisted state, as does a rollback without throwing.
+     */
+    void persist_frozen_block(TreeDBStats& dbStats);
+
     /**
      * @brief Commits the initial state of uncommitted data to the underlying store
      */
     void commit_genesis_state();
 
     /**
-     * @brief Rolls back the uncommitted state
+     * @brief Rolls back the uncommitted state, and the block committed by freeze_block if it could not be written
      */
     void rollback();
 
@@ -163,7 +199,11 @@ template <typename LeafValueType> class ContentAddressedCachedTreeStore {
     /**
      * @brief Returns a read transaction against the underlying store.
      */
-    ReadTransactionPtr create_read_transaction() const { return dataStore_->create_read_transaction(); }
+    ReadTransactionPtr create_read_transaction() const
+    {
+        // The block is taken before the transaction is opened: if it gets written in between, it is in both
+        return dataStore_->template create_read_transaction<ReadTransaction>(get_frozen_block());
+    }
 
     std::optional<IndexedLeafValueType> get_leaf_by_hash(const fr& leaf_hash,
                                                          ReadTransaction& tx,
@@ -204,6 +244,23 @@ template <typename LeafValueType> class ContentAddressedCachedTreeStore {
 
     Cache cache_;
 
+    // A block committed by freeze_block. Reads of committed data are served from here until the next block is
+    // committed, and by the read transactions opened until then for as long as they live, as they may have been
+    // opened before the block was written to the store
+    struct FrozenBlock {
+        Cache cache;
+        BlockPayload block;
+        // The committed size of the tree before the block
+        index_t previousSize;
+    };
+    std::shared_ptr<const FrozenBlock> frozen_;
+
+    // Whether the frozen block is being written to the store, and the error if that failed
+    bool persistPending_ = false;
+    std::optional<std::string> persistError_;
+    std::mutex persistMtx_;
+    std::condition_variable persistCondition_;
+
     void initialise();
 
     void initialise_from_block(const block_number_t& blockNumber);
@@ -214,7 +271,7 @@ template <typename LeafValueType> class ContentAddressedCachedTreeStore {
 
     void persist_meta(TreeMeta& m, WriteTransaction& tx);
 
-    void persist_node(const std::optional<fr>& optional_hash, uint32_t level, WriteTransaction& tx);
+    void persist_node(const Cache& cache, const std::optional<fr>& optional_hash, uint32_t level, WriteTransaction& tx);
 
     void remove_node(const std::optional<fr>& optional_hash,
                      uint32_t level,
@@ -229,7 +286,15 @@ template <typename LeafValueType> class ContentAddressedCachedTreeStore {
 
     void persist_block_for_index(const block_number_t& blockNumber, const index_t& index, WriteTransaction& tx);
 
-    void persist_leaf_indices(WriteTransaction& tx);
+    void persist_leaf_indices(const Cache& cache, WriteTransaction& tx);
+
+    void persist_block(const FrozenBlock& frozen);
+
+    std::shared_ptr<const FrozenBlock> get_frozen_block() const;
+
+    void wait_for_persisted_block();
+
+    void release_frozen_block();
 
     void delete_block_for_index(const block_number_t& blockNumber, const index_t& index, WriteTransaction& tx);
 
@@ -244,7 +309,6 @@ ContentAddressedCachedTreeStore<LeafValueType>::ContentAddressedCachedTreeStore(
                                                                                 PersistedStoreType::SharedPtr dataStore)
     : forkConstantData_{ .name_ = (std::move(name)), .depth_ = levels }
     , dataStore_(dataStore)
-    , cache_(levels)
 {
     initialise();
 }
@@ -256,7 +320,6 @@ ContentAddressedCachedTreeStore<LeafValueType>::ContentAddressedCachedTreeStore(
                                                                                 PersistedStoreType::SharedPtr dataStore)
     : forkConstantData_{ .name_ = (std::move(name)), .depth_ = levels }
     , dataStore_(dataStore)
-    , cache_(levels)
 {
     initialise_from_block(referenceBlockNumber);
 }
@@ -313,6 +376,10 @@ std::optional<block_number_t> ContentAddressedCachedTreeStore<LeafValueType>::fi
     if (index >= constrainedSize) {
         return std::nullopt;
     }
+    const FrozenBlock* frozen = tx.get_frozen_block();
+    if (frozen && index >= frozen->previousSize && index < frozen->block.size) {
+        return frozen->block.blockNumber;
+    }
     block_number_t blockNumber = 0;
     bool success = dataStore_->find_block_for_index(index, blockNumber, tx);
     return success ? std::make_optional(blockNumber) : std::nullopt;
@@ -350,6 +417,16 @@ std::pair<bool, index_t> ContentAddressedCachedTreeStore<LeafValueType>::find_lo
     index_t db_index = committed;
     uint256_t retrieved_value = found_key;
 
+    // The last committed block may not have been written to the store yet, its leaves are only in the frozen block
+    const FrozenBlock* frozen = tx.get_frozen_block();
+    if (frozen && sizeLimit >= frozen->block.size) {
+        auto floor = frozen->cache.get_indices().find_floor(new_value_as_number);
+        if (floor.has_value() && floor->first >= retrieved_value) {
+            retrieved_value = floor->first;
+            db_index = floor->second;
+        }
+    }
+
     // If we already found the leaf then return it.
     bool already_present = retrieved_value == new_value_as_number;
     if (already_present) {
@@ -380,6 +457,10 @@ ContentAddressedCachedTreeStore<LeafValueType>::get_leaf_by_hash(const fr& leaf_
             return leafData;
         }
     }
+    const FrozenBlock* frozen = tx.get_frozen_block();
+    if (frozen && frozen->cache.get_leaf_preimage_by_hash(leaf_hash, leafData)) {
+        return leafData;
+    }
     if (dataStore_->read_leaf_by_hash(leaf_hash, leafData, tx)) {
         return leafData;
     }
@@ -463,6 +544,19 @@ std::optional<index_t> ContentAddressedCachedTreeStore<LeafValueType>::find_leaf
     }
 
     // we have been asked to not include uncommitted data, or there is none available
+    // The leaves of the last committed block may only be in the frozen block, they take precedence over the store
+    // as they would once written to it
+    const FrozenBlock* frozen = tx.get_frozen_block();
+    if (frozen) {
+        std::optional<index_t> frozenIndex = frozen->cache.get_leaf_key_index(preimage_to_key(leaf));
+        index_t sizeLimit = constrain_tree_size_to_only_committed(requestContext, tx);
+        if (frozenIndex.has_value() && frozenIndex.value() < sizeLimit) {
+            if (frozenIndex.value() >= start_index) {
+                return frozenIndex;
+            }
+            return std::nullopt;
+        }
+    }
     index_t committed = 0;
     FrKeyType key = leaf;
     bool success = dataStore_->read_leaf_index(key, committed, tx);
@@ -503,6 +597,10 @@ bool ContentAddressedCachedTreeStore<LeafValueType>::get_node_by_hash(const fr&
             return true;
         }
     }
+    const FrozenBlock* frozen = transaction.get_frozen_block();
+    if (frozen && frozen->cache.get_node(nodeHash, payload)) {
+        return true;
+    }
     return dataStore_->read_node(nodeHash, payload, transaction);
 }
 
@@ -569,13 +667,21 @@ bool ContentAddressedCachedTreeStore<LeafValueType>::get_block_data(const block_
                                                                     BlockPayload& blockData,
                                                                     ReadTransaction& tx) const
 {
+    const FrozenBlock* frozen = tx.get_frozen_block();
+    if (frozen && frozen->block.blockNumber == blockNumber) {
+        blockData = frozen->block;
+        return true;
+    }
     return dataStore_->read_block_data(blockNumber, blockData, tx);
 }
 
 template <typename LeafValueType>
 bool ContentAddressedCachedTreeStore<LeafValueType>::read_persisted_meta(TreeMeta& m, ReadTransaction& tx) const
 {
-    if (!dataStore_->read_meta_data(m, tx)) {
+    const FrozenBlock* frozen = tx.get_frozen_block();
+    if (frozen) {
+        m = frozen->cache.get_meta();
+    } else if (!dataStore_->read_meta_data(m, tx)) {
         return false;
     }
     // Having read the meta from the store, we need to enrich it with the fork constant data if available
@@ -616,12 +722,11 @@ fr ContentAddressedCachedTreeStore<LeafValueType>::get_current_root(ReadTransact
 // are in progress, hence no data synchronisation is used.
 
 template <typename LeafValueType>
-void ContentAddressedCachedTreeStore<LeafValueType>::persist_leaf_indices(WriteTransaction& tx)
+void ContentAddressedCachedTreeStore<LeafValueType>::persist_leaf_indices(const Cache& cache, WriteTransaction& tx)
 {
-    const std::map<uint256_t, index_t>& indices = cache_.get_indices();
-    for (const auto& idx : indices) {
-        FrKeyType key = idx.first;
-        dataStore_->write_leaf_index(key, idx.second, tx);
+    // Written in key order, which is the order of the database
+    for (const auto& [key, index] : cache.get_indices().get_sorted_entries()) {
+        dataStore_->write_leaf_index(key, index, tx);
     }
 }
 
@@ -634,6 +739,7 @@ template <typename LeafValueType> void ContentAddressedCachedTreeStore<LeafValue
     if (forkConstantData_.initialised_from_block_.has_value()) {
         throw std::runtime_error("Committing a fork is forbidden");
     }
+    release_frozen_block();
     get_meta(meta);
     NodePayload rootPayload;
     dataPresent = cache_.get_node(meta.root, rootPayload);
@@ -641,8 +747,8 @@ template <typename LeafValueType> void ContentAddressedCachedTreeStore<LeafValue
         WriteTransactionPtr tx = create_write_transaction();
         try {
             if (dataPresent) {
-                persist_leaf_indices(*tx);
-                persist_node(std::optional<fr>(meta.root), 0, *tx);
+                persist_leaf_indices(cache_, *tx);
+                persist_node(cache_, std::optional<fr>(meta.root), 0, *tx);
             }
 
             meta.committedSize = meta.size;
@@ -661,57 +767,161 @@ template <typename LeafValueType> void ContentAddressedCachedTreeStore<LeafValue
 template <typename LeafValueType>
 void ContentAddressedCachedTreeStore<LeafValueType>::commit_block(TreeMeta& finalMeta, TreeDBStats& dbStats)
 {
-    bool dataPresent = false;
-    TreeMeta meta;
+    TreeMeta uncommittedMeta;
+    get_meta(uncommittedMeta);
+    freeze_block(finalMeta);
+    try {
+        persist_frozen_block(dbStats);
+    } catch (std::exception&) {
+        // Return the data to the uncommitted state, as it was before the commit
+        std::shared_ptr<const FrozenBlock> frozen = get_frozen_block();
+        {
+            std::unique_lock lock(persistMtx_);
+            persistError_.reset();
+        }
+        std::unique_lock lock(mtx_);
+        cache_ = frozen->cache;
+        cache_.put_meta(uncommittedMeta);
+        frozen_.reset();
+        throw;
+    }
+    release_frozen_block();
+}
 
+template <typename LeafValueType>
+void ContentAddressedCachedTreeStore<LeafValueType>::freeze_block(TreeMeta& finalMeta)
+{
     // We don't allow commits using images/forks
     if (forkConstantData_.initialised_from_block_.has_value()) {
         throw std::runtime_error("Committing a fork is forbidden");
     }
+    wait_for_persisted_block();
+
+    TreeMeta committedMeta;
+    {
+        ReadTransactionPtr tx = create_read_transaction();
+        read_persisted_meta(committedMeta, *tx);
+    }
+    TreeMeta meta;
     get_meta(meta);
-    NodePayload rootPayload;
-    dataPresent = cache_.get_node(meta.root, rootPayload);
+    ++meta.unfinalisedBlockHeight;
+    if (meta.oldestHistoricBlock == 0) {
+        meta.oldestHistoricBlock = 1;
+    }
+    meta.committedSize = meta.size;
+
     {
-        WriteTransactionPtr tx = create_write_transaction();
-        try {
-            if (dataPresent) {
-                // std::cout << "Persisting data for block " << uncommittedMeta.unfinalisedBlockHeight + 1 << std::endl;
-                // Persist the leaf indices
-                persist_leaf_indices(*tx);
-            }
-            // If we are commiting a block, we need to persist the root, since the new block "references" this root
-            // However, if the root is the empty root we can't persist it, since it's not a real node and doesn't have
-            // nodes beneath it. We coujld store a 'dummy' node to represent it but then we have to work around the
-            // absence of a real tree elsewhere. So, if the tree is completely empty we do not store any node data, the
-            // only issue is this needs to be recognised when we unwind or remove historic blocks i.e. there will be no
-            // node date to remove for these blocks
-            if (dataPresent || meta.size > 0) {
-                persist_node(std::optional<fr>(meta.root), 0, *tx);
-            }
-            ++meta.unfinalisedBlockHeight;
-            if (meta.oldestHistoricBlock == 0) {
-                meta.oldestHistoricBlock = 1;
-            }
-            // std::cout << "New root " << uncommittedMeta.root << std::endl;
-            BlockPayload block{ .size = meta.size, .blockNumber = meta.unfinalisedBlockHeight, .root = meta.root };
-            dataStore_->write_block_data(meta.unfinalisedBlockHeight, block, *tx);
-            dataStore_->write_block_index_data(block.blockNumber, block.size, *tx);
+        std::unique_lock lock(mtx_);
+        auto frozen = std::make_shared<FrozenBlock>(FrozenBlock{
+            .cache = std::move(cache_),
+            .block = { .size = meta.size, .blockNumber = meta.unfinalisedBlockHeight, .root = meta.root },
+            .previousSize = committedMeta.committedSize,
+        });
+        frozen->cache.put_meta(meta);
+        frozen_ = std::move(frozen);
+        // The new block starts from an empty cache, as after a rollback
+        cache_ = Cache();
+        cache_.put_meta(meta);
+    }
+    {
+        std::unique_lock lock(persistMtx_);
+        persistPending_ = true;
+    }
+    finalMeta = meta;
+}
 
-            meta.committedSize = meta.size;
-            persist_meta(meta, *tx);
-            tx->commit();
-        } catch (std::exception& e) {
-            tx->try_abort();
-            throw std::runtime_error(
-                format("Unable to commit data to tree: ", forkConstantData_.name_, " Error: ", e.what()));
+template <typename LeafValueType>
+void ContentAddressedCachedTreeStore<LeafValueType>::persist_frozen_block(TreeDBStats& dbStats)
+{
+    {
+        std::unique_lock lock(persistMtx_);
+        if (!persistPending_) {
+            throw std::runtime_error(format("No committed block to persist. Tree name: ", forkConstantData_.name_));
         }
     }
-    finalMeta = meta;
+    std::optional<std::string> error;
+    try {
+        persist_block(*get_frozen_block());
+    } catch (std::exception& e) {
+        error = format("Unable to commit data to tree: ", forkConstantData_.name_, " Error: ", e.what());
+    }
+    {
+        std::unique_lock lock(persistMtx_);
+        persistPending_ = false;
+        persistError_ = error;
+    }
+    persistCondition_.notify_all();
+    if (error.has_value()) {
+        throw std::runtime_error(error.value());
+    }
+    extract_db_stats(dbStats);
+}
 
-    // rolling back destroys all cache stores and also refreshes the cached meta_ from persisted state
-    rollback();
+template <typename LeafValueType>
+void ContentAddressedCachedTreeStore<LeafValueType>::persist_block(const FrozenBlock& frozen)
+{
+    TreeMeta meta = frozen.cache.get_meta();
+    NodePayload rootPayload;
+    bool dataPresent = frozen.cache.get_node(meta.root, rootPayload);
+    WriteTransactionPtr tx = create_write_transaction();
+    try {
+        if (dataPresent) {
+            // Persist the leaf indices
+            persist_leaf_indices(frozen.cache, *tx);
+        }
+        // If we are commiting a block, we need to persist the root, since the new block "references" this root
+        // However, if the root is the empty root we can't persist it, since it's not a real node and doesn't have
+        // nodes beneath it. We coujld store a 'dummy' node to represent it but then we have to work around the
+        // absence of a real tree elsewhere. So, if the tree is completely empty we do not store any node data, the
+        // only issue is this needs to be recognised when we unwind or remove historic blocks i.e. there will be no
+        // node date to remove for these blocks
+        if (dataPresent || meta.size > 0) {
+            persist_node(frozen.cache, std::optional<fr>(meta.root), 0, *tx);
+        }
+        dataStore_->write_block_data(frozen.block.blockNumber, frozen.block, *tx);
+        dataStore_->write_block_index_data(frozen.block.blockNumber, frozen.block.size, *tx);
+        persist_meta(meta, *tx);
+        tx->commit();
+    } catch (std::exception&) {
+        tx->try_abort();
+        throw;
+    }
+}
 
-    extract_db_stats(dbStats);
+template <typename LeafValueType>
+std::shared_ptr<const typename ContentAddressedCachedTreeStore<LeafValueType>::FrozenBlock>
+ContentAddressedCachedTreeStore<LeafValueType>::get_frozen_block() const
+{
+    std::unique_lock lock(mtx_);
+    return frozen_;
+}
+
+template <typename LeafValueType> void ContentAddressedCachedTreeStore<LeafValueType>::wait_for_persisted_block()
+{
+    std::optional<std::string> error;
+    {
+        std::unique_lock lock(persistMtx_);
+        persistCondition_.wait(lock, [this] { return !persistPending_; });
+        error.swap(persistError_);
+    }
+    if (error.has_value()) {
+        // The frozen block, and anything added since, can't be committed any more
+        {
+            std::unique_lock lock(mtx_);
+            frozen_.reset();
+        }
+        rollback();
+        throw std::runtime_error(error.value());
+    }
+}
+
+template <typename LeafValueType> void ContentAddressedCachedTreeStore<LeafValueType>::release_frozen_block()
+{
+    // Called by the operations that read or write the store directly. Once the frozen block has been written, only the
+    // read transactions opened before that need it, and they hold on to it themselves
+    wait_for_persisted_block();
+    std::unique_lock lock(mtx_);
+    frozen_.reset();
 }
 
 template <typename LeafValueType>
@@ -725,7 +935,8 @@ void ContentAddressedCachedTreeStore<LeafValueType>::extract_db_stats(TreeDBStat
 }
 
 template <typename LeafValueType>
-void ContentAddressedCachedTreeStore<LeafValueType>::persist_node(const std::optional<fr>& optional_hash,
+void ContentAddressedCachedTreeStore<LeafValueType>::persist_node(const Cache& cache,
+                                                                  const std::optional<fr>& optional_hash,
                                                                   uint32_t level,
                                                                   WriteTransaction& tx)
 {
@@ -751,14 +962,14 @@ void ContentAddressedCachedTreeStore<LeafValueType>::persist_node(const std::opt
         if (so.lvl == forkConstantData_.depth_) {
             // this is a leaf, we need to persist the pre-image
             IndexedLeafValueType leafPreImage;
-            if (cache_.get_leaf_preimage_by_hash(hash, leafPreImage)) {
+            if (cache.get_leaf_preimage_by_hash(hash, leafPreImage)) {
                 dataStore_->write_leaf_by_hash(hash, leafPreImage, tx);
             }
         }
 
         // std::cout << "Persisting node hash " << hash << " at level " << so.lvl << std::endl;
         NodePayload nodePayload;
-        if (!cache_.get_node(hash, nodePayload)) {
+        if (!cache.get_node(hash, nodePayload)) {
             //  need to increase the stored node's reference count here
             dataStore_->increment_node_reference_count(hash, tx);
             continue;
@@ -777,8 +988,21 @@ void ContentAddressedCachedTreeStore<LeafValueType>::persist_node(const std::opt
 
 template <typename LeafValueType> void ContentAddressedCachedTreeStore<LeafValueType>::rollback()
 {
+    // A block that could not be written is rolled back along with the uncommitted data
+    bool persistFailed = false;
+    {
+        std::unique_lock lock(persistMtx_);
+        if (!persistPending_ && persistError_.has_value()) {
+            persistError_.reset();
+            persistFailed = true;
+        }
+    }
+    if (persistFailed) {
+        std::unique_lock lock(mtx_);
+        frozen_.reset();
+    }
     // Extract the committed meta data and destroy the cache
-    cache_.reset(forkConstantData_.depth_);
+    cache_.reset();
     {
         ReadTransactionPtr tx = create_read_transaction();
         TreeMeta committedMeta;
@@ -806,6 +1030,7 @@ void ContentAddressedCachedTreeStore<LeafValueType>::advance_finalised_block(con
     if (forkConstantData_.initialised_from_block_.has_value()) {
         throw std::runtime_error("Advancing the finalised block on a fork is forbidden");
     }
+    release_frozen_block();
     {
         // read both committed and uncommitted meta values
         ReadTransactionPtr tx = create_read_transaction();
@@ -874,6 +1099,7 @@ void ContentAddressedCachedTreeStore<LeafValueType>::unwind_block(const block_nu
     if (forkConstantData_.initialised_from_block_.has_value()) {
         throw std::runtime_error("Removing a block on a fork is forbidden");
     }
+    release_frozen_block();
     {
         ReadTransactionPtr tx = create_read_transaction();
         get_meta(uncommittedMeta);
@@ -979,6 +1205,7 @@ void ContentAddressedCachedTreeStore<LeafValueType>::remove_historical_block(con
     if (forkConstantData_.initialised_from_block_.has_value()) {
         throw std::runtime_error("Removing a block on a fork is forbidden");
     }
+    release_frozen_block();
     {
         // retrieve both the committed and uncommitted meta data, validate the provide block is the oldest historical
         // block
@@ -1,5 +1,7 @@
 #pragma once
+#include "./leaf_key_index.hpp"
 #include "./tree_meta.hpp"
+#include "barretenberg/common/ankerl_dense.hpp"
 #include "barretenberg/crypto/merkle_tree/indexed_tree/indexed_leaf.hpp"
 #include "barretenberg/crypto/merkle_tree/lmdb_store/lmdb_tree_store.hpp"
 #include "barretenberg/crypto/merkle_tree/types.hpp"
@@ -16,35 +18,32 @@
 #include <optional>
 #include <sstream>
 #include <stdexcept>
-#include <unordered_map>
 #include <utility>
 #include <vector>
 
-template <> struct std::hash<uint256_t> {
-    std::size_t operator()(const uint256_t& k) const { return k.data[0]; }
-};
-template <> struct std::hash<bb::fr> {
-    std::size_t operator()(const bb::fr& k) const
-    {
-        bb::numeric::uint256_t val(k);
-        return val.data[0];
-    }
-};
-
 namespace bb::crypto::merkle_tree {
 
 // Stores all of the penidng updates to a mekle tree indexed for optimal retrieval
 // Also stores a journal of inverse changes to the cache, enabling checkpoints and
 // and subsequent commit/revert operations
+// All of the stores are open addressing hash maps keeping their entries in a single contiguous array, so that the
+// tens of thousands of updates of a block do not each cost an allocation, and are released all at once
 template <typename LeafValueType> class ContentAddressedCache {
   public:
     using LeafType = LeafValueType;
     using IndexedLeafValueType = IndexedLeaf<LeafValueType>;
     using SharedPtr = std::shared_ptr<ContentAddressedCache>;
     using UniquePtr = std::unique_ptr<ContentAddressedCache>;
-
-    ContentAddressedCache() = delete;
-    ContentAddressedCache(uint32_t depth);
+    // The level and the index of a node within that level
+    using NodeLocation = std::pair<uint32_t, index_t>;
+    template <typename Key, typename Value>
+    using Map = ankerl::unordered_dense::map<Key,
+                                             Value,
+                                             std::conditional_t<std::is_same_v<Key, fr>,
+                                                                TreeKeyHash,
+                                                                ankerl::unordered_dense::hash<Key>>>;
+
+    ContentAddressedCache() = default;
     ~ContentAddressedCache() = default;
     ContentAddressedCache(const ContentAddressedCache& other) = default;
     ContentAddressedCache& operator=(const ContentAddressedCache& other) = default;
@@ -56,7 +55,7 @@ template <typename LeafValueType> class ContentAddressedCache {
     void revert();
     void commit();
 
-    void reset(uint32_t depth);
+    void reset();
     std::pair<bool, index_t> find_low_value(const uint256_t& new_leaf_key,
                                             const uint256_t& retrieved_value,
                                             const index_t& db_index) const;
@@ -79,7 +78,7 @@ template <typename LeafValueType> class ContentAddressedCache {
     std::optional<fr> get_node_by_index(uint32_t level, const index_t& index) const;
     void put_node_by_index(uint32_t level, const index_t& index, const fr& node);
 
-    const std::map<uint256_t, index_t>& get_indices() const { return indices_; }
+    const LeafKeyIndex& get_indices() const { return indices_; }
 
     bool is_equivalent_to(const ContentAddressedCache& other) const;
 
@@ -89,46 +88,39 @@ template <typename LeafValueType> class ContentAddressedCache {
         TreeMeta meta_;
         // Captures the cache's node hashes at the time of checkpoint. If the node does not exist in the cache, the
         // optional will == nullopt
-        // TODO (PhilWindle): Consider where a more optimal approach is a single unordered map, instead of 1 per level
-        std::vector<std::unordered_map<index_t, std::optional<fr>>> nodes_by_index_;
+        Map<NodeLocation, std::optional<fr>> nodes_by_index_;
         // Captures the cache's leaf pre-images at the time of checkpoint. Again, if the leaf does not exist in the
         // cache, the optional will == nullopt
-        std::unordered_map<index_t, std::optional<IndexedLeafValueType>> leaf_pre_image_by_index_;
+        Map<index_t, std::optional<IndexedLeafValueType>> leaf_pre_image_by_index_;
         // Captures the addition of new leaf keys into the indices_ cache
         std::vector<uint256_t> new_leaf_keys_;
 
         Journal(TreeMeta meta)
             : meta_(std::move(meta))
-            , nodes_by_index_(meta_.depth + 1, std::unordered_map<index_t, std::optional<fr>>())
         {}
     };
     // This is a mapping between the node hash and it's payload (children and ref count) for every node in the tree,
     // including leaves. As indexed trees are updated, this will end up containing many nodes that are not part of the
     // final tree so they need to be omitted from what is committed.
-    std::unordered_map<fr, NodePayload> nodes_;
+    Map<fr, NodePayload> nodes_;
 
     // This is a store mapping the leaf key (e.g. slot for public data or nullifier value for nullifier tree) to the
     // index in the tree
-    std::map<uint256_t, index_t> indices_;
+    LeafKeyIndex indices_;
 
     // This is a mapping from leaf hash to leaf pre-image. This will contain entries that need to be omitted when
     // commiting updates
-    std::unordered_map<fr, IndexedLeafValueType> leaves_;
+    Map<fr, IndexedLeafValueType> leaves_;
     TreeMeta meta_;
 
     // The following stores are not persisted, just cached until commit
-    std::vector<std::unordered_map<index_t, fr>> nodes_by_index_;
-    std::unordered_map<index_t, IndexedLeafValueType> leaf_pre_image_by_index_;
+    Map<NodeLocation, fr> nodes_by_index_;
+    Map<index_t, IndexedLeafValueType> leaf_pre_image_by_index_;
 
     // The currently active journals
     std::vector<Journal> journals_;
 };
 
-template <typename LeafValueType> ContentAddressedCache<LeafValueType>::ContentAddressedCache(uint32_t depth)
-{
-    reset(depth);
-}
-
 template <typename LeafValueType> void ContentAddressedCache<LeafValueType>::checkpoint()
 {
     journals_.emplace_back(Journal(meta_));
@@ -147,15 +139,13 @@ template <typename LeafValueType> void ContentAddressedCache<LeafValueType>::rev
 
     Journal& journal = journals_.back();
 
-    for (uint32_t i = 0; i < journal.nodes_by_index_.size(); ++i) {
-        for (const auto& [index, optional_node_hash] : journal.nodes_by_index_[i]) {
-            // If the optional == nullopt then we remove it from the primary cache, it never existed before
-            if (!optional_node_hash.has_value()) {
-                nodes_by_index_[i].erase(index);
-            } else {
-                // The optional is not null, this means there is a vlue to be restored to the primary cache
-                nodes_by_index_[i][index] = optional_node_hash.value();
-            }
+    for (const auto& [location, optional_node_hash] : journal.nodes_by_index_) {
+        // If the optional == nullopt then we remove it from the primary cache, it never existed before
+        if (!optional_node_hash.has_value()) {
+            nodes_by_index_.erase(location);
+        } else {
+            // The optional is not null, this means there is a vlue to be restored to the primary cache
+            nodes_by_index_[location] = optional_node_hash.value();
         }
     }
 
@@ -199,26 +189,18 @@ template <typename LeafValueType> void ContentAddressedCache<LeafValueType>::com
     Journal& current_journal = journals_.back();
     Journal& previous_journal = journals_[journals_.size() - 2];
 
-    for (uint32_t i = 0; i < current_journal.nodes_by_index_.size(); ++i) {
-        for (const auto& [index, optional_node_hash] : current_journal.nodes_by_index_[i]) {
-            // There is an entry in the current journal, if it does not exist in the previous journal then we need to
-            // add it If it does exist in the previous journal then that journal already captured a value from the
-            // primary cache that existed no later
-            auto previousIter = previous_journal.nodes_by_index_[i].find(index);
-            if (previousIter == previous_journal.nodes_by_index_[i].end()) {
-                previous_journal.nodes_by_index_[i][index] = optional_node_hash;
-            }
-        }
+    for (const auto& [location, optional_node_hash] : current_journal.nodes_by_index_) {
+        // There is an entry in the current journal, if it does not exist in the previous journal then we need to
+        // add it If it does exist in the previous journal then that journal already captured a value from the
+        // primary cache that existed no later
+        previous_journal.nodes_by_index_.try_emplace(location, optional_node_hash);
     }
 
     for (const auto& [index, optional_leaf] : current_journal.leaf_pre_image_by_index_) {
         // There is an entry in the current journal, if it does not exist in the previous journal then we need to add it
         // If it does exist in the previous journal then that journal already captured a value from the
         // primary cache that existed no later
-        auto previousIter = previous_journal.leaf_pre_image_by_index_.find(index);
-        if (previousIter == previous_journal.leaf_pre_image_by_index_.end()) {
-            previous_journal.leaf_pre_image_by_index_[index] = optional_leaf;
-        }
+        previous_journal.leaf_pre_image_by_index_.try_emplace(index, optional_leaf);
     }
 
     // Add our newly appended leaf keys to those of the previous journal
@@ -230,13 +212,13 @@ template <typename LeafValueType> void ContentAddressedCache<LeafValueType>::com
     journals_.pop_back();
 }
 
-template <typename LeafValueType> void ContentAddressedCache<LeafValueType>::reset(uint32_t depth)
+template <typename LeafValueType> void ContentAddressedCache<LeafValueType>::reset()
 {
-    nodes_ = std::unordered_map<fr, NodePayload>();
-    indices_ = std::map<uint256_t, index_t>();
-    leaves_ = std::unordered_map<fr, IndexedLeafValueType>();
-    nodes_by_index_ = std::vector<std::unordered_map<index_t, fr>>(depth + 1, std::unordered_map<index_t, fr>());
-    leaf_pre_image_by_index_ = std::unordered_map<index_t, IndexedLeafValueType>();
+    nodes_ = Map<fr, NodePayload>();
+    indices_ = LeafKeyIndex();
+    leaves_ = Map<fr, IndexedLeafValueType>();
+    nodes_by_index_ = Map<NodeLocation, fr>();
+    leaf_pre_image_by_index_ = Map<index_t, IndexedLeafValueType>();
     journals_ = std::vector<Journal>();
 }
 
@@ -296,38 +278,28 @@ std::pair<bool, index_t> ContentAddressedCache<LeafValueType>::find_low_value(co
         return std::make_pair(new_leaf_key == retrieved_value, db_index);
     }
     // At this stage, we have been asked to include uncommitted and the value was not exactly found in the db
-    auto it = indices_.lower_bound(new_leaf_key);
-    if (it == indices_.end()) {
-        // there is no element >= the requested value.
-        // decrement the iterator to get the value preceeding the requested value
-        --it;
-        // we need to return the larger of the db value or the cached value
-
-        return std::make_pair(false, it->first > retrieved_value ? it->second : db_index);
+    auto floor = indices_.find_floor(new_leaf_key);
+    if (!floor.has_value()) {
+        // No cached value <= the requested value, return the db index
+        return std::make_pair(false, db_index);
     }
 
-    if (it->first == new_leaf_key) {
-        // the value is already present and the iterator points to it
-        return std::make_pair(true, it->second);
+    if (floor->first == new_leaf_key) {
+        // the value is already present
+        return std::make_pair(true, floor->second);
     }
-    // the iterator points to the element immediately larger than the requested value
+    // floor is the cached value immediately smaller than the requested value
     // We need to return the highest value from
-    // 1. The next lowest cached value, if there is one
+    // 1. The next lowest cached value
     // 2. The value retrieved from the db
-    if (it == indices_.begin()) {
-        // No cached lower value, return the db index
-        return std::make_pair(false, db_index);
-    }
-    --it;
-    //  it now points to the value less than that requested
-    return std::make_pair(false, it->first > retrieved_value ? it->second : db_index);
+    return std::make_pair(false, floor->first > retrieved_value ? floor->second : db_index);
 }
 
 template <typename LeafValueType>
 bool ContentAddressedCache<LeafValueType>::get_leaf_preimage_by_hash(const fr& leaf_hash,
                                                                      IndexedLeafValueType& leaf_pre_image) const
 {
-    typename std::unordered_map<fr, IndexedLeafValueType>::const_iterator it = leaves_.find(leaf_hash);
+    auto it = leaves_.find(leaf_hash);
     if (it != leaves_.end()) {
         leaf_pre_image = it->second;
         return true;
@@ -346,8 +318,7 @@ template <typename LeafValueType>
 bool ContentAddressedCache<LeafValueType>::get_leaf_by_index(const index_t& index,
                                                              IndexedLeafValueType& leaf_pre_image) const
 {
-    typename std::unordered_map<index_t, IndexedLeafValueType>::const_iterator it =
-        leaf_pre_image_by_index_.find(index);
+    auto it = leaf_pre_image_by_index_.find(index);
     if (it != leaf_pre_image_by_index_.end()) {
         leaf_pre_image = it->second;
         return true;
@@ -375,10 +346,7 @@ void ContentAddressedCache<LeafValueType>::put_leaf_by_index(const index_t& inde
         journal.leaf_pre_image_by_index_[index] = std::nullopt;
     } else {
         // There is a leaf pre-image. If the journal does not have a pre-image at this index then add it to the journal
-        auto journalIter = journal.leaf_pre_image_by_index_.find(index);
-        if (journalIter == journal.leaf_pre_image_by_index_.end()) {
-            journal.leaf_pre_image_by_index_[index] = cache_iter->second;
-        }
+        journal.leaf_pre_image_by_index_.try_emplace(index, cache_iter->second);
     }
     leaf_pre_image_by_index_[index] = leaf_pre_image;
 }
@@ -387,8 +355,7 @@ template <typename LeafValueType>
 void ContentAddressedCache<LeafValueType>::update_leaf_key_index(const index_t& index, const fr& leaf_key)
 {
     uint256_t key = uint256_t(leaf_key);
-    auto result = indices_.insert({ key, index });
-    if (result.second && !journals_.empty()) {
+    if (indices_.insert(key, index) && !journals_.empty()) {
         // The insertion took place, if we have a current journal then we need to add to the newly inserted leaf keys
         Journal& journal = journals_.back();
         journal.new_leaf_keys_.emplace_back(key);
@@ -398,11 +365,7 @@ void ContentAddressedCache<LeafValueType>::update_leaf_key_index(const index_t&
 template <typename LeafValueType>
 std::optional<index_t> ContentAddressedCache<LeafValueType>::get_leaf_key_index(const fr& leaf_key) const
 {
-    auto it = indices_.find(uint256_t(leaf_key));
-    if (it == indices_.end()) {
-        return std::nullopt;
-    }
-    return it->second;
+    return indices_.find(uint256_t(leaf_key));
 }
 
 template <typename LeafValueType>
@@ -425,8 +388,8 @@ bool ContentAddressedCache<LeafValueType>::get_node(const fr& node_hash, NodePay
 template <typename LeafValueType>
 std::optional<fr> ContentAddressedCache<LeafValueType>::get_node_by_index(uint32_t level, const index_t& index) const
 {
-    auto it = nodes_by_index_[level].find(index);
-    if (it == nodes_by_index_[level].end()) {
+    auto it = nodes_by_index_.find(NodeLocation(level, index));
+    if (it == nodes_by_index_.end()) {
         return std::nullopt;
     }
     return it->second;
@@ -436,8 +399,9 @@ template <typename LeafValueType>
 void ContentAddressedCache<LeafValueType>::put_node_by_index(uint32_t level, const index_t& index, const fr& node)
 {
     // If there is no current journal then we just update the cache and leave
+    const NodeLocation location(level, index);
     if (journals_.empty()) {
-        nodes_by_index_[level][index] = node;
+        nodes_by_index_[location] = node;
         return;
     }
 
@@ -445,16 +409,13 @@ void ContentAddressedCache<LeafValueType>::put_node_by_index(uint32_t level, con
     Journal& journal = journals_.back();
 
     // If there is no node at the given location then add a nullopt to the journal
-    auto cacheIter = nodes_by_index_[level].find(index);
-    if (cacheIter == nodes_by_index_[level].end()) {
-        journal.nodes_by_index_[level][index] = std::nullopt;
+    auto cacheIter = nodes_by_index_.find(location);
+    if (cacheIter == nodes_by_index_.end()) {
+        journal.nodes_by_index_[location] = std::nullopt;
     } else {
         // There is a node. If the journal does not have a node at this index then add it to the journal
-        auto journalIter = journal.nodes_by_index_[level].find(index);
-        if (journalIter == journal.nodes_by_index_[level].end()) {
-            journal.nodes_by_index_[level][index] = cacheIter->second;
-        }
+        journal.nodes_by_index_.try_emplace(location, cacheIter->second);
     }
-    nodes_by_index_[level][index] = node;
+    nodes_by_index_[location] = node;
 }
 } // namespace bb::crypto::merkle_tree
\ No newline at end of file
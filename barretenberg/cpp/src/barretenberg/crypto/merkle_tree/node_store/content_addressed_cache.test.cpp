@@ -64,15 +64,14 @@ CacheType create_cache(uint32_t depth)
     TreeMeta meta;
     meta.depth = depth;
     meta.size = 0;
-    CacheType cache(depth);
+    CacheType cache;
     cache.put_meta(meta);
     return cache;
 }
 
 TEST_F(ContentAddressedCacheTest, can_create_cache)
 {
-    constexpr uint32_t depth = 10;
-    EXPECT_NO_THROW(CacheType cache(depth));
+    EXPECT_NO_THROW(CacheType cache);
 }
 
 TEST_F(ContentAddressedCacheTest, can_checkpoint_cache)
@@ -0,0 +1,163 @@
+#pragma once
+#include "barretenberg/common/ankerl_dense.hpp"
+#include "barretenberg/crypto/merkle_tree/types.hpp"
+#include "barretenberg/numeric/uint256/uint256.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace bb::crypto::merkle_tree {
+
+/**
+ * @brief Maps the keys of the uncommitted leaves of an indexed tree to their leaf index
+ *
+ * @details Exact lookups are served by a flat hash map, which is the source of truth for the contents of the index.
+ * Ordered lookups, i.e. finding the low leaf of a new key, are served by a set of sorted runs of keys whose sizes
+ * decrease from the first run to the last, like the digits of a binary counter: an insertion appends a run of one key
+ * and merges the last two runs for as long as the last is not smaller than the one before it. An insertion then moves
+ * amortised O(log n) keys and a search makes O(log^2 n) comparisons, without the per-node allocations and the pointer
+ * chasing of a std::map.
+ *
+ * Erased keys are left in the runs and skipped by searches. They are dropped when their run is next merged, or by a
+ * compaction of all the runs once they make up half of the keys in the runs.
+ */
+class LeafKeyIndex {
+  public:
+    using Key = uint256_t;
+
+    /**
+     * @brief Map key to index, unless key is already present
+     * @return Whether the key was inserted
+     */
+    bool insert(const Key& key, const index_t& index)
+    {
+        if (!indices_.emplace(key, index).second) {
+            return false;
+        }
+        runs_.push_back({ key });
+        num_keys_in_runs_++;
+        while (runs_.size() > 1 && runs_[runs_.size() - 2].size() <= runs_.back().size()) {
+            merge_last_runs();
+        }
+        return true;
+    }
+
+    std::optional<index_t> find(const Key& key) const
+    {
+        auto it = indices_.find(key);
+        if (it == indices_.end()) {
+            return std::nullopt;
+        }
+        return it->second;
+    }
+
+    void erase(const Key& key)
+    {
+        if (indices_.erase(key) == 0) {
+            return;
+        }
+        num_erased_keys_in_runs_++;
+        if (2 * num_erased_keys_in_runs_ > num_keys_in_runs_) {
+            compact();
+        }
+    }
+
+    /**
+     * @brief The greatest key that is not greater than key, and its index
+     */
+    std::optional<std::pair<Key, index_t>> find_floor(const Key& key) const
+    {
+        std::optional<std::pair<Key, index_t>> result;
+        for (const auto& run : runs_) {
+            // Walk down from the last key of the run not greater than key until a key that has not been erased
+            auto it = std::upper_bound(run.begin(), run.end(), key);
+            while (it != run.begin()) {
+                --it;
+                if (result.has_value() && *it <= result->first) {
+                    break;
+                }
+                auto index_it = indices_.find(*it);
+                if (index_it != indices_.end()) {
+                    result = *index_it;
+                    break;
+                }
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @brief All the entries sorted by key
+     */
+    std::vector<std::pair<Key, index_t>> get_sorted_entries() const
+    {
+        std::vector<std::pair<Key, index_t>> entries(indices_.values().begin(), indices_.values().end());
+        std::sort(entries.begin(), entries.end());
+        return entries;
+    }
+
+    size_t size() const { return indices_.size(); }
+    bool empty() const { return indices_.empty(); }
+
+    void clear()
+    {
+        indices_.clear();
+        runs_.clear();
+        num_keys_in_runs_ = 0;
+        num_erased_keys_in_runs_ = 0;
+    }
+
+    bool operator==(const LeafKeyIndex& other) const { return indices_ == other.indices_; }
+
+  private:
+    // Merge the last two runs, dropping erased keys and the duplicates left by keys erased and inserted again
+    void merge_last_runs()
+    {
+        std::vector<Key> last = std::move(runs_.back());
+        runs_.pop_back();
+        std::vector<Key>& previous = runs_.back();
+        std::vector<Key> merged;
+        merged.reserve(previous.size() + last.size());
+        std::merge(previous.begin(), previous.end(), last.begin(), last.end(), std::back_inserter(merged));
+        merged.erase(std::unique(merged.begin(), merged.end()), merged.end());
+        if (num_erased_keys_in_runs_ > 0) {
+            merged.erase(std::remove_if(merged.begin(),
+                                        merged.end(),
+                                        [this](const Key& key) { return !indices_.contains(key); }),
+                         merged.end());
+        }
+        const size_t num_dropped = previous.size() + last.size() - merged.size();
+        num_keys_in_runs_ -= num_dropped;
+        num_erased_keys_in_runs_ -= std::min(num_dropped, num_erased_keys_in_runs_);
+        previous = std::move(merged);
+    }
+
+    // Replace the runs by a single run of the keys currently in the index
+    void compact()
+    {
+        std::vector<Key> keys;
+        keys.reserve(indices_.size());
+        for (const auto& [key, index] : indices_) {
+            keys.push_back(key);
+        }
+        std::sort(keys.begin(), keys.end());
+        runs_.clear();
+        if (!keys.empty()) {
+            runs_.push_back(std::move(keys));
+        }
+        num_keys_in_runs_ = indices_.size();
+        num_erased_keys_in_runs_ = 0;
+    }
+
+    ankerl::unordered_dense::map<Key, index_t, TreeKeyHash> indices_;
+    // Sorted runs of keys, of decreasing sizes
+    std::vector<std::vector<Key>> runs_;
+    size_t num_keys_in_runs_ = 0;
+    // Approximate number of keys in the runs that are no longer in indices_, used to decide when to compact
+    size_t num_erased_keys_in_runs_ = 0;
+};
+
+} // namespace bb::crypto::merkle_tree
@@ -0,0 +1,81 @@
+#include "barretenberg/crypto/merkle_tree/node_store/leaf_key_index.hpp"
+#include "barretenberg/common/test.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+#include <cstdint>
+#include <map>
+#include <vector>
+
+using namespace bb;
+using namespace bb::crypto::merkle_tree;
+
+namespace {
+auto& engine = numeric::get_debug_randomness();
+
+// The floor of key in a std::map, for reference
+std::optional<std::pair<uint256_t, index_t>> reference_floor(const std::map<uint256_t, index_t>& map,
+                                                             const uint256_t& key)
+{
+    auto it = map.upper_bound(key);
+    if (it == map.begin()) {
+        return std::nullopt;
+    }
+    --it;
+    return *it;
+}
+} // namespace
+
+TEST(LeafKeyIndex, MatchesOrderedMap)
+{
+    LeafKeyIndex index;
+    std::map<uint256_t, index_t> reference;
+    std::vector<uint256_t> inserted;
+
+    // Small keys, so that searches hit existing keys and erased keys get inserted again
+    const auto random_key = [&]() { return uint256_t(engine.get_random_uint64() % 3000); };
+    for (index_t i = 0; i < 5000; i++) {
+        const uint256_t key = random_key();
+        EXPECT_EQ(index.insert(key, i), reference.insert({ key, i }).second);
+        inserted.push_back(key);
+
+        // Erase a batch of recent keys from time to time, as reverting a checkpoint does
+        if (i % 97 == 0) {
+            for (size_t j = 0; j < 20 && !inserted.empty(); j++) {
+                index.erase(inserted.back());
+                reference.erase(inserted.back());
+                inserted.pop_back();
+            }
+        }
+
+        const uint256_t search_key = random_key();
+        EXPECT_EQ(index.find_floor(search_key), reference_floor(reference, search_key));
+        const auto found = index.find(search_key);
+        const auto reference_it = reference.find(search_key);
+        EXPECT_EQ(found.has_value(), reference_it != reference.end());
+        if (found.has_value()) {
+            EXPECT_EQ(found.value(), reference_it->second);
+        }
+    }
+
+    EXPECT_EQ(index.size(), reference.size());
+    const std::vector<std::pair<uint256_t, index_t>> expected_entries(reference.begin(), reference.end());
+    EXPECT_EQ(index.get_sorted_entries(), expected_entries);
+}
+
+TEST(LeafKeyIndex, FloorSkipsErasedKeys)
+{
+    LeafKeyIndex index;
+    for (index_t i = 0; i < 64; i++) {
+        index.insert(uint256_t(10 * i), i);
+    }
+    index.erase(uint256_t(300));
+    index.erase(uint256_t(290));
+    EXPECT_EQ(index.find_floor(uint256_t(305)), std::make_pair(uint256_t(280), index_t(28)));
+    EXPECT_EQ(index.find_floor(uint256_t(5)), std::make_pair(uint256_t(0), index_t(0)));
+
+    // A key inserted again after being erased is found with its new index
+    index.insert(uint256_t(300), 1000);
+    EXPECT_EQ(index.find_floor(uint256_t(305)), std::make_pair(uint256_t(300), index_t(1000)));
+
+    index.erase(uint256_t(0));
+    EXPECT_FALSE(index.find_floor(uint256_t(5)).has_value());
+}
@@ -1,14 +1,36 @@
 #pragma once
 
+#include "barretenberg/common/ankerl_dense.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/lmdblib/types.hpp"
 #include "lmdb.h"
 #include <cstdint>
 #include <optional>
+
 namespace bb::crypto::merkle_tree {
 
 using namespace bb::lmdblib;
 
+/**
+ * @brief Hash of the node hashes and leaf keys used as keys of the hash maps caching tree data
+ * @details Mixes all of the limbs, and declares it with is_avalanching so that ankerl::unordered_dense uses it as it
+ * is. The generic std::hash of field elements only xors shifted limbs.
+ */
+struct TreeKeyHash {
+    using is_avalanching = void;
+    std::size_t operator()(const uint256_t& k) const noexcept
+    {
+        return static_cast<std::size_t>(ankerl::unordered_dense::detail::wyhash::hash(k.data, sizeof(k.data)));
+    }
+    std::size_t operator()(const bb::fr& k) const noexcept
+    {
+        // Field elements compare equal on their reduced Montgomery form, no need to convert out of it
+        const bb::fr reduced = k.reduce_once();
+        return static_cast<std::size_t>(
+            ankerl::unordered_dense::detail::wyhash::hash(reduced.data, sizeof(reduced.data)));
+    }
+};
+
 using index_t = uint64_t;
 using block_number_t = uint64_t;
 using LeafIndexKeyType = uint64_t;
@@ -1,4 +1,5 @@
 #include "poseidon2.hpp"
+#include "barretenberg/common/assert.hpp"
 
 namespace bb::crypto {
 /**
@@ -10,6 +11,50 @@ typename Poseidon2<Params>::FF Poseidon2<Params>::hash(const std::vector<typenam
     return Sponge::hash_internal(input);
 }
 
+/**
+ * @brief Hashes two field elements, equal to hash({ lhs, rhs }) without going through a heap allocated vector
+ * @details Two inputs fit in the rate of the sponge, so the hash is the first element of a single permutation of the
+ * inputs followed by the domain separator of a 2 element input and a 1 element output, see FieldSponge::hash_internal
+ */
+template <typename Params>
+typename Poseidon2<Params>::FF Poseidon2<Params>::hash_pair(const FF& lhs, const FF& rhs)
+{
+    static_assert(Params::t == 4);
+    const FF iv(static_cast<uint256_t>(2) << 64);
+    return Permutation::permutation({ lhs, rhs, FF(0), iv })[0];
+}
+
+/**
+ * @brief Hashes independent pairs of field elements: output[i] = hash_pair(input[2 * i], input[2 * i + 1])
+ */
+template <typename Params>
+void Poseidon2<Params>::hash_pairs(std::span<const FF> input, std::span<FF> output)
+{
+    static_assert(Params::t == 4);
+    constexpr size_t NUM_LANES = Permutation::NUM_LANES;
+    ASSERT(input.size() == 2 * output.size());
+    const FF iv(static_cast<uint256_t>(2) << 64);
+
+    const size_t num_full_batches = output.size() / NUM_LANES;
+    typename Permutation::LaneState state;
+    for (size_t batch = 0; batch < num_full_batches; ++batch) {
+        const size_t offset = batch * NUM_LANES;
+        for (size_t j = 0; j < NUM_LANES; ++j) {
+            state[0][j] = input[2 * (offset + j)];
+            state[1][j] = input[2 * (offset + j) + 1];
+            state[2][j] = FF(0);
+            state[3][j] = iv;
+        }
+        Permutation::permutation_lanes(state);
+        for (size_t j = 0; j < NUM_LANES; ++j) {
+            output[offset + j] = state[0][j];
+        }
+    }
+    for (size_t i = num_full_batches * NUM_LANES; i < output.size(); ++i) {
+        output[i] = hash_pair(input[2 * i], input[2 * i + 1]);
+    }
+}
+
 /**
  * @brief Hashes vector of bytes by chunking it into 31 byte field elements and calling hash()
  * @details Slice function cuts out the required number of bytes from the byte vector
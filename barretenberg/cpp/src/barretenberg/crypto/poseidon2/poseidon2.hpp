@@ -4,6 +4,8 @@
 #include "poseidon2_permutation.hpp"
 #include "sponge/sponge.hpp"
 
+#include <span>
+
 namespace bb::crypto {
 
 template <typename Params> class Poseidon2 {
@@ -11,12 +13,23 @@ template <typename Params> class Poseidon2 {
     using FF = typename Params::FF;
 
     // We choose our rate to be t-1 and capacity to be 1.
-    using Sponge = FieldSponge<FF, Params::t - 1, 1, Params::t, Poseidon2Permutation<Params>>;
+    using Permutation = Poseidon2Permutation<Params>;
+    using Sponge = FieldSponge<FF, Params::t - 1, 1, Params::t, Permutation>;
 
     /**
      * @brief Hashes a vector of field elements
      */
     static FF hash(const std::vector<FF>& input);
+    /**
+     * @brief Hashes two field elements, equal to hash({ lhs, rhs }) without going through a heap allocated vector
+     */
+    static FF hash_pair(const FF& lhs, const FF& rhs);
+    /**
+     * @brief Hashes independent pairs of field elements: output[i] = hash_pair(input[2 * i], input[2 * i + 1])
+     * @details The permutations of Permutation::NUM_LANES pairs are computed together, see
+     * Poseidon2Permutation::permutation_lanes
+     */
+    static void hash_pairs(std::span<const FF> input, std::span<FF> output);
     /**
      * @brief Hashes vector of bytes by chunking it into 31 byte field elements and calling hash()
      * @details Slice function cuts out the required number of bytes from the byte vector
@@ -64,3 +64,23 @@ TEST(Poseidon2, HashBufferConsistencyCheck)
     EXPECT_NE(result1, expected);
     EXPECT_EQ(result2, expected);
 }
+
+TEST(Poseidon2, HashPairsMatchHash)
+{
+    using Poseidon2 = crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>;
+
+    // Not a multiple of the number of lanes, so that the remainder is hashed one pair at a time
+    const size_t num_pairs = 3 * Poseidon2::Permutation::NUM_LANES + 1;
+    std::vector<fr> input(2 * num_pairs);
+    for (auto& element : input) {
+        element = fr::random_element(&engine);
+    }
+    std::vector<fr> output(num_pairs);
+    Poseidon2::hash_pairs(input, output);
+
+    for (size_t i = 0; i < num_pairs; ++i) {
+        const fr expected = Poseidon2::hash({ input[2 * i], input[2 * i + 1] });
+        EXPECT_EQ(Poseidon2::hash_pair(input[2 * i], input[2 * i + 1]), expected);
+        EXPECT_EQ(output[i], expected);
+    }
+}
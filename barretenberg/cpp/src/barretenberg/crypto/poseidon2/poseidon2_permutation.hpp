@@ -40,6 +40,12 @@ template <typename Params> class Poseidon2Permutation {
     using MatrixDiagonal = std::array<FF, t>;
     using RoundConstantsContainer = std::array<RoundConstants, NUM_ROUNDS>;
 
+    // Number of independent permutations interleaved by permutation_lanes
+    static constexpr size_t NUM_LANES = 8;
+    using Lanes = std::array<FF, NUM_LANES>;
+    // Structure-of-arrays state of NUM_LANES permutations: state[i][j] is element i of the state of lane j
+    using LaneState = std::array<Lanes, t>;
+
     static constexpr MatrixDiagonal internal_matrix_diagonal = Params::internal_matrix_diagonal;
     static constexpr RoundConstantsContainer round_constants = Params::round_constants;
 
@@ -160,5 +166,97 @@ template <typename Params> class Poseidon2Permutation {
         }
         return current_state;
     }
+
+    /**
+     * @brief Applies the permutation to NUM_LANES independent states at once
+     * @details Each step of the permutation is applied to all lanes before moving on to the next one, so that the
+     * field multiplications of different lanes, which do not depend on each other, are issued back to back and
+     * overlap in the pipeline. This matters most in the internal rounds, where a single permutation is a chain of
+     * dependent multiplications through the S-box of state[0].
+     */
+    static constexpr void permutation_lanes(LaneState& state)
+    {
+        matrix_multiplication_external_lanes(state);
+
+        constexpr size_t rounds_f_beginning = rounds_f / 2;
+        for (size_t i = 0; i < rounds_f_beginning; ++i) {
+            add_round_constants_lanes(state, round_constants[i]);
+            for (auto& element : state) {
+                apply_sbox_lanes(element);
+            }
+            matrix_multiplication_external_lanes(state);
+        }
+
+        const size_t p_end = rounds_f_beginning + rounds_p;
+        for (size_t i = rounds_f_beginning; i < p_end; ++i) {
+            for (auto& lane : state[0]) {
+                lane += round_constants[i][0];
+            }
+            apply_sbox_lanes(state[0]);
+            matrix_multiplication_internal_lanes(state);
+        }
+
+        for (size_t i = p_end; i < NUM_ROUNDS; ++i) {
+            add_round_constants_lanes(state, round_constants[i]);
+            for (auto& element : state) {
+                apply_sbox_lanes(element);
+            }
+            matrix_multiplication_external_lanes(state);
+        }
+    }
+
+  private:
+    static constexpr void add_round_constants_lanes(LaneState& state, const RoundConstants& rc)
+    {
+        for (size_t i = 0; i < t; ++i) {
+            for (auto& lane : state[i]) {
+                lane += rc[i];
+            }
+        }
+    }
+
+    static constexpr void apply_sbox_lanes(Lanes& input)
+    {
+        Lanes xxxx;
+        for (size_t j = 0; j < NUM_LANES; ++j) {
+            xxxx[j] = input[j].sqr();
+        }
+        for (size_t j = 0; j < NUM_LANES; ++j) {
+            xxxx[j].self_sqr();
+        }
+        for (size_t j = 0; j < NUM_LANES; ++j) {
+            input[j] *= xxxx[j];
+        }
+    }
+
+    static constexpr void matrix_multiplication_external_lanes(LaneState& state)
+    {
+        for (size_t j = 0; j < NUM_LANES; ++j) {
+            State lane;
+            for (size_t i = 0; i < t; ++i) {
+                lane[i] = state[i][j];
+            }
+            matrix_multiplication_external(lane);
+            for (size_t i = 0; i < t; ++i) {
+                state[i][j] = lane[i];
+            }
+        }
+    }
+
+    static constexpr void matrix_multiplication_internal_lanes(LaneState& state)
+    {
+        Lanes sum = state[0];
+        for (size_t i = 1; i < t; ++i) {
+            for (size_t j = 0; j < NUM_LANES; ++j) {
+                sum[j] += state[i][j];
+            }
+        }
+        for (size_t i = 0; i < t; ++i) {
+            for (size_t j = 0; j < NUM_LANES; ++j) {
+                state[i][j] *= internal_matrix_diagonal[i];
+                state[i][j] += sum[j];
+            }
+        }
+    }
 };
 } // namespace bb::crypto
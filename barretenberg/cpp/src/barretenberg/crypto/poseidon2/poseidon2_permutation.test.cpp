@@ -59,3 +59,25 @@ TEST(Poseidon2Permutation, ConsistencyCheck)
     };
     EXPECT_EQ(result, expected);
 }
+
+TEST(Poseidon2Permutation, LanesMatchSinglePermutation)
+{
+    using Permutation = crypto::Poseidon2Permutation<crypto::Poseidon2Bn254ScalarFieldParams>;
+
+    std::array<Permutation::State, Permutation::NUM_LANES> inputs;
+    Permutation::LaneState state;
+    for (size_t j = 0; j < Permutation::NUM_LANES; ++j) {
+        for (size_t i = 0; i < Permutation::t; ++i) {
+            inputs[j][i] = fr::random_element(&engine);
+            state[i][j] = inputs[j][i];
+        }
+    }
+    Permutation::permutation_lanes(state);
+
+    for (size_t j = 0; j < Permutation::NUM_LANES; ++j) {
+        const auto expected = Permutation::permutation(inputs[j]);
+        for (size_t i = 0; i < Permutation::t; ++i) {
+            EXPECT_EQ(state[i][j], expected[i]);
+        }
+    }
+}
@@ -361,6 +361,52 @@ TEST(fr, BatchInvert)
     }
 }
 
+TEST(fr, ParallelBatchInvert)
+{
+    // Large enough to be split into several chunks
+    size_t n = 1 << 14;
+    std::vector<fr> coeffs(n);
+    for (size_t i = 0; i < n; ++i) {
+        coeffs[i] = (i % 7 == 0) ? fr::zero() : fr::random_element();
+    }
+    std::vector<fr> inverses = coeffs;
+    fr::parallel_batch_invert(inverses);
+
+    for (size_t i = 0; i < n; ++i) {
+        if (coeffs[i].is_zero()) {
+            EXPECT_TRUE(inverses[i].is_zero());
+        } else {
+            EXPECT_EQ(coeffs[i] * inverses[i], fr::one());
+        }
+    }
+}
+
+TEST(fr, ParallelBatchInvertArrays)
+{
+    const std::array<size_t, 3> sizes{ 1 << 12, 0, 1000 };
+    std::array<std::vector<fr>, 3> coeffs;
+    std::array<std::vector<fr>, 3> inverses;
+    std::array<std::span<fr>, 3> arrays;
+    for (size_t j = 0; j < 3; ++j) {
+        for (size_t i = 0; i < sizes[j]; ++i) {
+            coeffs[j].emplace_back((i % 5 == j) ? fr::zero() : fr::random_element());
+        }
+        inverses[j] = coeffs[j];
+        arrays[j] = inverses[j];
+    }
+    fr::parallel_batch_invert(arrays);
+
+    for (size_t j = 0; j < 3; ++j) {
+        for (size_t i = 0; i < sizes[j]; ++i) {
+            if (coeffs[j][i].is_zero()) {
+                EXPECT_TRUE(inverses[j][i].is_zero());
+            } else {
+                EXPECT_EQ(coeffs[j][i] * inverses[j][i], fr::one());
+            }
+        }
+    }
+}
+
 TEST(fr, MultiplicativeGenerator)
 {
     EXPECT_EQ(fr::multiplicative_generator(), fr(5));
@@ -330,6 +330,8 @@ template <class Params_> struct alignas(32) field {
     constexpr field invert() const noexcept;
     static void batch_invert(std::span<field> coeffs) noexcept;
     static void batch_invert(field* coeffs, size_t n) noexcept;
+    static void parallel_batch_invert(std::span<field> coeffs);
+    static void parallel_batch_invert(std::span<const std::span<field>> arrays);
     /**
      * @brief Compute square root of the field element.
      *
@@ -1,9 +1,11 @@
 #pragma once
 #include "barretenberg/common/op_count.hpp"
 #include "barretenberg/common/slab_allocator.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/numeric/random/engine.hpp"
+#include <algorithm>
 #include <memory>
 #include <span>
 #include <type_traits>
@@ -454,6 +456,79 @@ template <class T> void field<T>::batch_invert(std::span<field> coeffs) noexcept
     }
 }
 
+/**
+ * @brief Batch inversion of a large array, split into chunks that are inverted in parallel with one inversion each
+ * @details As in batch_invert, zeroes are skipped and left as they are.
+ */
+template <class T> void field<T>::parallel_batch_invert(std::span<field> coeffs)
+{
+    PROFILE_THIS_NAME("fr::parallel_batch_invert");
+    // A multiplication on the way forward and two on the way back
+    constexpr size_t ELEMENT_COST = 3 * thread_heuristics::FF_MULTIPLICATION_COST;
+    parallel_for_heuristic(
+        coeffs.size(),
+        [&](size_t start, size_t end, BB_UNUSED size_t chunk_index) {
+            batch_invert(coeffs.subspan(start, end - start));
+        },
+        ELEMENT_COST);
+}
+
+/**
+ * @brief Batch inversion of several independent arrays, split into chunks of rows that are inverted in parallel
+ * @details Within a chunk, the running products of the arrays are accumulated side by side, so that the
+ * multiplications of a row do not depend on each other and can be pipelined. The products of all the arrays are then
+ * inverted together, with a single inversion per chunk. Arrays may have different sizes, and zeroes are skipped and
+ * left as they are.
+ */
+template <class T> void field<T>::parallel_batch_invert(std::span<const std::span<field>> arrays)
+{
+    PROFILE_THIS_NAME("fr::parallel_batch_invert");
+    const size_t num_arrays = arrays.size();
+    size_t num_rows = 0;
+    for (const auto& array : arrays) {
+        num_rows = std::max(num_rows, array.size());
+    }
+    if (num_rows == 0) {
+        return;
+    }
+
+    // The running products of row i are stored next to each other, at i * num_arrays
+    auto temporaries_ptr = std::static_pointer_cast<field[]>(get_mem_slab(num_rows * num_arrays * sizeof(field)));
+    auto* temporaries = temporaries_ptr.get();
+    const auto inverts = [&](size_t array_idx, size_t row) {
+        return row < arrays[array_idx].size() && !arrays[array_idx][row].is_zero();
+    };
+
+    const size_t row_cost = 3 * num_arrays * thread_heuristics::FF_MULTIPLICATION_COST;
+    parallel_for_heuristic(
+        num_rows,
+        [&](size_t start, size_t end, BB_UNUSED size_t chunk_index) {
+            std::vector<field> accumulators(num_arrays, one());
+            for (size_t row = start; row < end; ++row) {
+                for (size_t array_idx = 0; array_idx < num_arrays; ++array_idx) {
+                    temporaries[row * num_arrays + array_idx] = accumulators[array_idx];
+                    if (inverts(array_idx, row)) {
+                        accumulators[array_idx] *= arrays[array_idx][row];
+                    }
+                }
+            }
+
+            // None of the products is zero, so they are all inverted
+            batch_invert(accumulators);
+
+            for (size_t row = end; row-- > start;) {
+                for (size_t array_idx = 0; array_idx < num_arrays; ++array_idx) {
+                    if (inverts(array_idx, row)) {
+                        field inverse = accumulators[array_idx] * temporaries[row * num_arrays + array_idx];
+                        accumulators[array_idx] *= arrays[array_idx][row];
+                        arrays[array_idx][row] = inverse;
+                    }
+                }
+            }
+        },
+        row_cost);
+}
+
 /**
  * @brief Implements an optimised variant of Tonelli-Shanks via lookup tables.
  * Algorithm taken from https://cr.yp.to/papers/sqroot-20011123-retypeset20220327.pdf
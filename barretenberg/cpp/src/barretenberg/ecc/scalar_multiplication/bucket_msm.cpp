@@ -0,0 +1,343 @@
+#include "barretenberg/ecc/scalar_multiplication/bucket_msm.hpp"
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/op_count.hpp"
+#include "barretenberg/common/stats.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/numeric/bitop/get_msb.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+
+namespace bb::scalar_multiplication {
+
+namespace {
+void record_msm_stats(size_t num_msms, size_t num_scalars, size_t max_num_scalars)
+{
+    BB_STATS_ADD("msm/count", num_msms);
+    BB_STATS_ADD("msm/scalars", num_scalars);
+    BB_STATS_MAX("msm/max_scalars", max_num_scalars);
+}
+} // namespace
+
+template <typename Curve> typename BucketMSM<Curve>::UnitScratch& BucketMSM<Curve>::thread_scratch()
+{
+    thread_local UnitScratch scratch;
+    return scratch;
+}
+
+template <typename Curve> size_t BucketMSM<Curve>::get_optimal_window_bits(const size_t num_points)
+{
+    // Relative costs, in units of one batched affine addition (~6 field multiplications): summing a bucket into the
+    // running sums takes a mixed and a full Jacobian addition (~5 units), and every level of the bucket reduction needs
+    // one field inversion.
+    constexpr size_t BUCKET_ACCUMULATION_COST = 5;
+    constexpr size_t INVERSION_COST = 40;
+    constexpr size_t MAX_WINDOW_BITS = 20;
+
+    size_t optimal_bits = 1;
+    size_t optimal_cost = std::numeric_limits<size_t>::max();
+    for (size_t bits = 1; bits <= MAX_WINDOW_BITS; ++bits) {
+        const size_t num_buckets = 1UL << (bits - 1);
+        const size_t points_per_bucket = std::max(num_points / num_buckets, static_cast<size_t>(1));
+        const size_t num_levels = numeric::get_msb(static_cast<uint64_t>(points_per_bucket)) + 1;
+        const size_t cost =
+            get_num_rounds(bits) * (num_points + num_buckets * BUCKET_ACCUMULATION_COST + num_levels * INVERSION_COST);
+        if (cost < optimal_cost) {
+            optimal_cost = cost;
+            optimal_bits = bits;
+        }
+    }
+    return optimal_bits;
+}
+
+/**
+ * @brief Reduce every bucket to (at most) a single affine point
+ * @details On entry, `bucket_points` contains the points of every bucket, grouped by bucket, and `bucket_counts` the
+ * number of points in each bucket. Every level adds consecutive pairs of points of a bucket, until all counts are at
+ * most 1. All the slope denominators 1/(x2 - x1) of one level are computed with a single field inversion: a forward
+ * pass accumulates the products of the x-differences, and the backward pass of the inversion performs the additions
+ * directly, writing the results to `reduced_points`. The two buffers are then swapped for the next level.
+ */
+template <typename Curve> void BucketMSM<Curve>::reduce_buckets(const size_t num_buckets, UnitScratch& scratch)
+{
+    auto& bucket_counts = scratch.bucket_counts;
+    auto& prefix_products = scratch.denominators;
+
+    size_t num_points = 0;
+    for (size_t bucket = 0; bucket < num_buckets; ++bucket) {
+        num_points += bucket_counts[bucket];
+    }
+    while (true) {
+        const AffineElement* points = scratch.bucket_points.data();
+        AffineElement* reduced_points = scratch.reduced_points.data();
+
+        // Products of the x-differences of all pairs of this level
+        size_t pair_idx = 0;
+        size_t point_idx = 0;
+        Fq accumulator = Fq::one();
+        for (size_t bucket = 0; bucket < num_buckets; ++bucket) {
+            const size_t count = bucket_counts[bucket];
+            for (size_t j = 0; j < count / 2; ++j) {
+                prefix_products[pair_idx++] = accumulator;
+                accumulator *= points[point_idx + 1].x - points[point_idx].x;
+                point_idx += 2;
+            }
+            point_idx += count & 1;
+        }
+        if (pair_idx == 0) {
+            return;
+        }
+
+        // Invert, then walk the pairs backwards, peeling off one denominator per pair and adding it
+        Fq inverse = accumulator.invert();
+        size_t result_idx = num_points - pair_idx;
+        num_points = result_idx;
+        --point_idx;
+        bool more_additions = false;
+        for (size_t bucket = num_buckets - 1; bucket < num_buckets; --bucket) {
+            const size_t count = bucket_counts[bucket];
+            if ((count & 1) != 0) {
+                reduced_points[--result_idx] = points[point_idx--];
+            }
+            for (size_t j = 0; j < count / 2; ++j) {
+                const AffineElement& point_2 = points[point_idx--];
+                const AffineElement& point_1 = points[point_idx--];
+                const Fq difference = point_2.x - point_1.x;
+                const Fq denominator = prefix_products[--pair_idx] * inverse;
+                inverse *= difference;
+                reduced_points[--result_idx] = add_with_denominator(point_1, point_2, denominator);
+            }
+            bucket_counts[bucket] = static_cast<uint32_t>(count / 2 + (count & 1));
+            more_additions = more_additions || bucket_counts[bucket] > 1;
+        }
+        std::swap(scratch.bucket_points, scratch.reduced_points);
+        if (!more_additions) {
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Compute ∑ (b + 1)⋅B_b over the reduced buckets B_b with the usual running sum
+ */
+template <typename Curve>
+typename BucketMSM<Curve>::Element BucketMSM<Curve>::accumulate_buckets(const size_t num_buckets, UnitScratch& scratch)
+{
+    // The reduced buckets are stored contiguously, empty buckets take no space
+    size_t point_idx = 0;
+    for (size_t bucket = 0; bucket < num_buckets; ++bucket) {
+        point_idx += scratch.bucket_counts[bucket];
+    }
+
+    Element running_sum = Element::infinity();
+    Element result = Element::infinity();
+    for (size_t bucket = num_buckets - 1; bucket < num_buckets; --bucket) {
+        if (scratch.bucket_counts[bucket] != 0) {
+            running_sum += scratch.bucket_points[--point_idx];
+        }
+        result += running_sum;
+    }
+    return result;
+}
+
+template <typename Curve>
+typename BucketMSM<Curve>::Element BucketMSM<Curve>::evaluate_round(const size_t round,
+                                                                    const size_t window_bits,
+                                                                    const size_t num_points,
+                                                                    const AffineElement* points,
+                                                                    UnitScratch& scratch)
+{
+    const size_t num_buckets = 1UL << (window_bits - 1);
+    auto& digits = scratch.digits;
+    auto& bucket_counts = scratch.bucket_counts;
+
+    // Counting sort of the points by bucket. Bucket b holds the points with digit ±(b + 1).
+    std::fill(bucket_counts.begin(), bucket_counts.begin() + static_cast<std::ptrdiff_t>(2 * num_buckets), 0);
+    uint32_t* counts = &bucket_counts[0];
+    uint32_t* cursors = &bucket_counts[num_buckets];
+    for (size_t i = 0; i < num_points; ++i) {
+        const int32_t digit = get_signed_digit(scratch.split_scalars[i], round, window_bits);
+        digits[i] = digit;
+        if (digit != 0) {
+            counts[static_cast<size_t>(std::abs(digit)) - 1]++;
+        }
+    }
+    uint32_t offset = 0;
+    for (size_t bucket = 0; bucket < num_buckets; ++bucket) {
+        cursors[bucket] = offset;
+        offset += counts[bucket];
+    }
+    if (offset == 0) {
+        return Element::infinity();
+    }
+    // Scatter the (conditionally negated) points into bucket order. The point table is read sequentially, which is
+    // much cheaper than gathering it in bucket order.
+    auto& bucket_points = scratch.bucket_points;
+    for (size_t i = 0; i < num_points; ++i) {
+        const int32_t digit = digits[i];
+        if (digit != 0) {
+            AffineElement& target = bucket_points[cursors[static_cast<size_t>(std::abs(digit)) - 1]++];
+            target = points[i];
+            if (digit < 0) {
+                target.y = -target.y;
+            }
+        }
+    }
+
+    reduce_buckets(num_buckets, scratch);
+    return accumulate_buckets(num_buckets, scratch);
+}
+
+template <typename Curve>
+typename BucketMSM<Curve>::Element BucketMSM<Curve>::evaluate_unit(std::span<const Fr> scalars,
+                                                                   std::span<const AffineElement> point_table,
+                                                                   UnitScratch& scratch)
+{
+    const size_t num_points = scalars.size() * 2;
+    ASSERT(num_points <= point_table.size());
+    ASSERT(num_points < (1UL << 31));
+
+    // Split every scalar k into k1, k2 such that k⋅G = k1⋅G + k2⋅(βx, -y)
+    const size_t window_bits = get_optimal_window_bits(num_points);
+    const size_t num_rounds = get_num_rounds(window_bits);
+    const size_t num_buckets = 1UL << (window_bits - 1);
+    const auto grow = [](auto& buffer, size_t size) {
+        if (buffer.size() < size) {
+            buffer.resize(size);
+        }
+    };
+    grow(scratch.split_scalars, num_points);
+    grow(scratch.digits, num_points);
+    grow(scratch.bucket_counts, 2 * num_buckets);
+    grow(scratch.bucket_points, num_points);
+    grow(scratch.reduced_points, num_points);
+    grow(scratch.denominators, num_points / 2);
+
+    auto& split_scalars = scratch.split_scalars;
+    for (size_t i = 0; i < scalars.size(); ++i) {
+        if (scalars[i].is_zero()) {
+            split_scalars[2 * i] = { 0, 0 };
+            split_scalars[2 * i + 1] = { 0, 0 };
+            continue;
+        }
+        const auto [k1, k2] = Fr::split_into_endomorphism_scalars(scalars[i].from_montgomery_form());
+        split_scalars[2 * i] = k1;
+        split_scalars[2 * i + 1] = k2;
+    }
+
+    // Horner's rule over the rounds, most significant window first
+    Element result = Element::infinity();
+    for (size_t round = num_rounds - 1; round < num_rounds; --round) {
+        if (!result.is_point_at_infinity()) {
+            for (size_t i = 0; i < window_bits; ++i) {
+                result.self_dbl();
+            }
+        }
+        result += evaluate_round(round, window_bits, num_points, point_table.data(), scratch);
+    }
+    return result;
+}
+
+template <typename Curve>
+typename BucketMSM<Curve>::Element BucketMSM<Curve>::msm(PolynomialSpan<const Fr> scalars,
+                                                         std::span<const AffineElement> point_table)
+{
+    PROFILE_THIS_NAME("BucketMSM::msm");
+    const size_t num_scalars = scalars.size();
+    if (num_scalars == 0) {
+        return Element::infinity();
+    }
+    record_msm_stats(1, num_scalars, num_scalars);
+    ASSERT(2 * scalars.end_index() <= point_table.size() && "Point table is too small for these scalars");
+    std::span<const AffineElement> points = point_table.subspan(2 * scalars.start_index, 2 * num_scalars);
+
+    if (num_scalars <= SMALL_MSM_THRESHOLD) {
+        Element result = Element::infinity();
+        for (size_t i = 0; i < num_scalars; ++i) {
+            if (!scalars.span[i].is_zero()) {
+                result += Element(points[2 * i]) * scalars.span[i];
+            }
+        }
+        return result;
+    }
+
+    // Split the scalars into contiguous units of (nearly) equal size, one per thread
+    const size_t num_units = calculate_num_threads(num_scalars, MIN_SCALARS_PER_UNIT);
+    const size_t unit_size = num_scalars / num_units;
+    const size_t leftover = num_scalars % num_units;
+    std::vector<Element> unit_results(num_units);
+    parallel_for(num_units, [&](size_t unit_idx) {
+        const size_t start = unit_idx * unit_size + std::min(unit_idx, leftover);
+        const size_t size = unit_size + (unit_idx < leftover ? 1 : 0);
+        UnitScratch& scratch = thread_scratch();
+        unit_results[unit_idx] =
+            evaluate_unit(scalars.span.subspan(start, size), points.subspan(2 * start, 2 * size), scratch);
+    });
+
+    Element result = unit_results[0];
+    for (size_t i = 1; i < num_units; ++i) {
+        result += unit_results[i];
+    }
+    return result;
+}
+
+template <typename Curve>
+std::vector<typename BucketMSM<Curve>::Element> BucketMSM<Curve>::batch_msm(
+    std::span<const PolynomialSpan<const Fr>> scalars, std::span<const AffineElement> point_table)
+{
+    PROFILE_THIS_NAME("BucketMSM::batch_msm");
+    const size_t num_msms = scalars.size();
+    size_t end_index = 0;
+    size_t total_num_scalars = 0;
+    size_t max_num_scalars = 0;
+    for (const auto& msm_scalars : scalars) {
+        end_index = std::max(end_index, msm_scalars.end_index());
+        total_num_scalars += msm_scalars.size();
+        max_num_scalars = std::max(max_num_scalars, msm_scalars.size());
+    }
+    record_msm_stats(num_msms, total_num_scalars, max_num_scalars);
+    ASSERT(2 * end_index <= point_table.size() && "Point table is too small for these scalars");
+
+    // Split the point index space [0, end_index) into one range per thread, sized by the total amount of work
+    const size_t num_ranges = std::min(calculate_num_threads(total_num_scalars, MIN_SCALARS_PER_UNIT),
+                                       std::max(end_index / MIN_SCALARS_PER_UNIT, static_cast<size_t>(1)));
+    const size_t range_size = (end_index + num_ranges - 1) / num_ranges;
+    std::vector<std::vector<Element>> range_results(num_ranges, std::vector<Element>(num_msms, Element::infinity()));
+    parallel_for(num_ranges, [&](size_t range_idx) {
+        const size_t range_start = range_idx * range_size;
+        const size_t range_end = std::min(range_start + range_size, end_index);
+        UnitScratch& scratch = thread_scratch();
+        for (size_t msm_idx = 0; msm_idx < num_msms; ++msm_idx) {
+            const auto& msm_scalars = scalars[msm_idx];
+            const size_t start = std::max(range_start, msm_scalars.start_index);
+            const size_t end = std::min(range_end, msm_scalars.end_index());
+            if (start >= end) {
+                continue;
+            }
+            std::span<const Fr> unit_scalars = msm_scalars.span.subspan(start - msm_scalars.start_index, end - start);
+            std::span<const AffineElement> unit_points = point_table.subspan(2 * start, 2 * (end - start));
+            if (unit_scalars.size() <= SMALL_MSM_THRESHOLD) {
+                for (size_t i = 0; i < unit_scalars.size(); ++i) {
+                    if (!unit_scalars[i].is_zero()) {
+                        range_results[range_idx][msm_idx] += Element(unit_points[2 * i]) * unit_scalars[i];
+                    }
+                }
+            } else {
+                range_results[range_idx][msm_idx] = evaluate_unit(unit_scalars, unit_points, scratch);
+            }
+        }
+    });
+
+    std::vector<Element> results = std::move(range_results[0]);
+    for (size_t range_idx = 1; range_idx < num_ranges; ++range_idx) {
+        for (size_t msm_idx = 0; msm_idx < num_msms; ++msm_idx) {
+            results[msm_idx] += range_results[range_idx][msm_idx];
+        }
+    }
+    return results;
+}
+
+template class BucketMSM<curve::BN254>;
+template class BucketMSM<curve::Grumpkin>;
+} // namespace bb::scalar_multiplication
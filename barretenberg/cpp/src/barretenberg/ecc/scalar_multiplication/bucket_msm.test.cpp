@@ -0,0 +1,160 @@
+#include "barretenberg/ecc/scalar_multiplication/bucket_msm.hpp"
+#include "barretenberg/common/test.hpp"
+#include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace bb {
+
+namespace {
+auto& engine = numeric::get_debug_randomness();
+}
+
+template <typename Curve> class BucketMsmTests : public ::testing::Test {
+  public:
+    using Element = typename Curve::Element;
+    using G1 = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+    using MSM = scalar_multiplication::BucketMSM<Curve>;
+
+    // Random points and the corresponding pippenger point table. (The points must be independent, e.g. an arithmetic
+    // progression would make partial bucket sums collide and break the unsafe affine additions.)
+    static std::vector<G1> generate_point_table(size_t num_points)
+    {
+        std::vector<G1> table(num_points * 2);
+        for (size_t i = 0; i < num_points; ++i) {
+            table[i] = G1::random_element(&engine);
+        }
+        scalar_multiplication::generate_pippenger_point_table<Curve>(table.data(), table.data(), num_points);
+        return table;
+    }
+
+    static Element naive_msm(PolynomialSpan<const Fr> scalars, const std::vector<G1>& table)
+    {
+        Element result = Element::infinity();
+        for (size_t i = 0; i < scalars.size(); ++i) {
+            result += Element(table[2 * (scalars.start_index + i)]) * scalars.span[i];
+        }
+        return result;
+    }
+};
+
+using Curves = ::testing::Types<curve::BN254, curve::Grumpkin>;
+TYPED_TEST_SUITE(BucketMsmTests, Curves);
+
+TYPED_TEST(BucketMsmTests, SignedDigitsReconstructScalar)
+{
+    using MSM = typename TestFixture::MSM;
+    for (size_t window_bits = 1; window_bits <= 20; ++window_bits) {
+        const std::array<uint64_t, 2> scalar{ engine.get_random_uint64(), engine.get_random_uint64() >> 1 };
+        uint256_t reconstructed = 0;
+        for (size_t round = MSM::get_num_rounds(window_bits) - 1; round < MSM::get_num_rounds(window_bits); --round) {
+            const int32_t digit = MSM::get_signed_digit(scalar, round, window_bits);
+            EXPECT_LE(std::abs(digit), 1 << (window_bits - 1));
+            reconstructed = reconstructed << window_bits;
+            if (digit >= 0) {
+                reconstructed += uint256_t(static_cast<uint64_t>(digit));
+            } else {
+                reconstructed -= uint256_t(static_cast<uint64_t>(-digit));
+            }
+        }
+        EXPECT_EQ(reconstructed, uint256_t(scalar[0], scalar[1], 0, 0));
+    }
+}
+
+TYPED_TEST(BucketMsmTests, MatchesNaiveMsm)
+{
+    using Element = typename TestFixture::Element;
+    using Fr = typename TestFixture::Fr;
+    using MSM = typename TestFixture::MSM;
+
+    // Sizes around the small-MSM threshold, and sizes which are not powers of 2
+    const size_t max_size = 3000;
+    auto table = TestFixture::generate_point_table(max_size);
+    for (size_t num_scalars : { 1UL, 5UL, 128UL, 129UL, 1000UL, 2999UL }) {
+        std::vector<Fr> scalars(num_scalars);
+        for (auto& scalar : scalars) {
+            scalar = Fr::random_element(&engine);
+        }
+        PolynomialSpan<const Fr> span{ 0, scalars };
+        Element expected = TestFixture::naive_msm(span, table);
+        Element result = MSM::msm(span, table);
+        EXPECT_EQ(result, expected) << "num_scalars = " << num_scalars;
+    }
+}
+
+TYPED_TEST(BucketMsmTests, StartIndexAndZeroScalars)
+{
+    using Element = typename TestFixture::Element;
+    using Fr = typename TestFixture::Fr;
+    using MSM = typename TestFixture::MSM;
+
+    const size_t start_index = 77;
+    const size_t num_scalars = 2500;
+    auto table = TestFixture::generate_point_table(start_index + num_scalars);
+    std::vector<Fr> scalars(num_scalars);
+    for (size_t i = 0; i < num_scalars; ++i) {
+        // Mix zeros, small scalars and full scalars
+        scalars[i] = (i % 3 == 0) ? Fr::zero() : (i % 3 == 1 ? Fr(i) : Fr::random_element(&engine));
+    }
+    PolynomialSpan<const Fr> span{ start_index, scalars };
+    Element expected = TestFixture::naive_msm(span, table);
+    Element result = MSM::msm(span, table);
+    EXPECT_EQ(result, expected);
+
+    std::fill(scalars.begin(), scalars.end(), Fr::zero());
+    EXPECT_TRUE(MSM::msm(span, table).is_point_at_infinity());
+}
+
+TYPED_TEST(BucketMsmTests, UnitWithReusedScratch)
+{
+    using Element = typename TestFixture::Element;
+    using Fr = typename TestFixture::Fr;
+    using MSM = typename TestFixture::MSM;
+
+    auto table = TestFixture::generate_point_table(2048);
+    typename MSM::UnitScratch scratch;
+    for (size_t num_scalars : { 2048UL, 300UL, 1500UL }) {
+        std::vector<Fr> scalars(num_scalars);
+        for (auto& scalar : scalars) {
+            scalar = Fr::random_element(&engine);
+        }
+        Element expected = TestFixture::naive_msm({ 0, scalars }, table);
+        EXPECT_EQ(MSM::evaluate_unit(scalars, table, scratch), expected);
+    }
+}
+
+TYPED_TEST(BucketMsmTests, BatchMsmMatchesIndividualMsms)
+{
+    using Element = typename TestFixture::Element;
+    using Fr = typename TestFixture::Fr;
+    using MSM = typename TestFixture::MSM;
+
+    const size_t num_points = 4000;
+    auto table = TestFixture::generate_point_table(num_points);
+    // Overlapping ranges of different sizes, including an empty, a small and a full one
+    const std::vector<std::pair<size_t, size_t>> ranges = {
+        { 0, num_points }, { 1234, 100 }, { 3000, 1000 }, { 500, 0 }, { 17, 2500 }
+    };
+    std::vector<std::vector<Fr>> scalars;
+    std::vector<PolynomialSpan<const Fr>> spans;
+    for (const auto& [start_index, size] : ranges) {
+        auto& msm_scalars = scalars.emplace_back(size);
+        for (auto& scalar : msm_scalars) {
+            scalar = Fr::random_element(&engine);
+        }
+    }
+    for (size_t i = 0; i < ranges.size(); ++i) {
+        spans.emplace_back(ranges[i].first, scalars[i]);
+    }
+
+    std::vector<Element> results = MSM::batch_msm(spans, table);
+    ASSERT_EQ(results.size(), ranges.size());
+    for (size_t i = 0; i < ranges.size(); ++i) {
+        EXPECT_EQ(results[i], TestFixture::naive_msm(spans[i], table)) << "msm " << i;
+    }
+}
+
+} // namespace bb
@@ -101,20 +101,41 @@ namespace bb::scalar_multiplication {
 /**
  * The pippppenger point table computes for each point P = (x,y), a point P' = (\beta * x, -y) which enables us
  * to use the curve endomorphism for faster scalar multiplication. See below for more details.
+ *
+ * `points` and `table` may point to the same memory location. In that case the table is built in place level by
+ * level: the points in [lo, hi) with lo = ceil(hi / 2) write their entries to [2 * lo, 2 * hi), which lies at or above
+ * hi, so no entry overwrites a point that has not been read yet and every level can be processed in parallel.
+ * Otherwise `points` and `table` must not overlap and all entries are computed in a single parallel pass.
  */
 template <typename Curve>
 void generate_pippenger_point_table(const typename Curve::AffineElement* points,
                                     typename Curve::AffineElement* table,
                                     size_t num_points)
 {
-    // iterate backwards, so that `points` and `table` can point to the same memory location
     using Fq = typename Curve::BaseField;
-    Fq beta = Fq::cube_root_of_unity();
-    for (size_t i = num_points - 1; i < num_points; --i) {
+    const Fq beta = Fq::cube_root_of_unity();
+    const auto compute_entry = [&](size_t i) {
         table[i * 2] = points[i];
         table[i * 2 + 1].x = beta * points[i].x;
         table[i * 2 + 1].y = -points[i].y;
+    };
+    constexpr size_t entry_cost = thread_heuristics::FF_MULTIPLICATION_COST + 4 * thread_heuristics::FF_COPY_COST;
+
+    if (num_points == 0) {
+        return;
+    }
+    if (points != table) {
+        parallel_for_heuristic(num_points, compute_entry, entry_cost);
+        return;
+    }
+    size_t hi = num_points;
+    while (hi > 1) {
+        const size_t lo = (hi + 1) / 2;
+        parallel_for_heuristic(
+            hi - lo, [&](size_t i) { compute_entry(lo + i); }, entry_cost);
+        hi = lo;
     }
+    compute_entry(0);
 }
 
 /**
@@ -419,6 +419,8 @@ class ECCVMFlavor {
             }
             return result;
         }
+
+        class LazyRow;
         // Set all shifted polynomials based on their to-be-shifted counterpart
         void set_shifted()
         {
@@ -699,6 +701,53 @@ class ECCVMFlavor {
         }
     };
 
+    /**
+     * @brief The entry of a prover polynomial at the current row of a LazyRow, read when it is accessed
+     */
+    class LazyEntry {
+      public:
+        LazyEntry() = default;
+        LazyEntry(const Polynomial& polynomial, const size_t& row_idx)
+            : polynomial(&polynomial)
+            , row_idx(&row_idx)
+        {}
+
+        operator const FF&() const { return (*polynomial)[*row_idx]; }
+        friend bool operator==(const LazyEntry& entry, const FF& value)
+        {
+            return static_cast<const FF&>(entry) == value;
+        }
+
+      private:
+        const Polynomial* polynomial = nullptr;
+        const size_t* row_idx = nullptr;
+    };
+
+    /**
+     * @brief A row of the prover polynomials that, unlike get_row, only reads the entries that are accessed
+     * @details Used where a relation reads a few columns of many rows, e.g. to compute the log-derivative inverses. The
+     * row is moved with set_row, so the view is neither copied nor moved.
+     */
+    class ProverPolynomials::LazyRow : public AllEntities<LazyEntry> {
+      public:
+        explicit LazyRow(ProverPolynomials& polynomials)
+        {
+            for (auto [entry, polynomial] : zip_view(this->get_all(), polynomials.get_all())) {
+                entry = LazyEntry(polynomial, row_idx);
+            }
+        }
+        LazyRow(const LazyRow&) = delete;
+        LazyRow(LazyRow&&) = delete;
+        LazyRow& operator=(const LazyRow&) = delete;
+        LazyRow& operator=(LazyRow&&) = delete;
+        ~LazyRow() = default;
+
+        void set_row(const size_t row) { row_idx = row; }
+
+      private:
+        size_t row_idx = 0;
+    };
+
     /**
      * @brief A container for storing the partially evaluated multivariates produced by sumcheck.
      */
@@ -92,9 +92,10 @@ void ECCVMProver::execute_log_derivative_commitments_round()
     relation_parameters.eccvm_set_permutation_delta =
         gamma * (gamma + beta_sqr) * (gamma + beta_sqr + beta_sqr) * (gamma + beta_sqr + beta_sqr + beta_sqr);
     relation_parameters.eccvm_set_permutation_delta = relation_parameters.eccvm_set_permutation_delta.invert();
-    // Compute inverse polynomial for our logarithmic-derivative lookup method
+    // Compute inverse polynomial for our logarithmic-derivative lookup method. The lookup selectors are wires, which
+    // are zero beyond the real size of the ECCVM
     compute_logderivative_inverse<typename Flavor::FF, typename Flavor::LookupRelation>(
-        key->polynomials, relation_parameters, unmasked_witness_size);
+        key->polynomials, relation_parameters, unmasked_witness_size, { { 0, key->real_size + 1 } });
     commit_to_witness_polynomial(key->polynomials.lookup_inverses, commitment_labels.lookup_inverses);
 }
 
@@ -1,8 +1,10 @@
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 
 #include "./eccvm_builder_types.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/stdlib_circuit_builders/op_queue/ecc_op_queue.hpp"
 
 namespace bb {
@@ -136,10 +138,9 @@ class ECCVMMSMMBuilder {
         // start with empty row (shiftable polynomials must have 0 as first coefficient)
         msm_rows[0] = (MSMRow{});
         // compute "read counts" so that we can determine the number of times entries in our log-derivative lookup
-        // tables are called.
-        // Note: this part is single-threaded. The amount of compute is low, however, so this is likely not a big
-        // concern.
-        for (size_t msm_idx = 0; msm_idx < msms.size(); ++msm_idx) {
+        // tables are called. Each point has its own rows in the read counts table, so the MSMs can be processed
+        // concurrently.
+        parallel_for_msms(msm_row_counts, num_msm_rows, [&](size_t msm_idx) {
             for (size_t digit_idx = 0; digit_idx < NUM_WNAF_DIGITS_PER_SCALAR; ++digit_idx) {
                 auto pc = static_cast<uint32_t>(pc_values[msm_idx]);
                 const auto& msm = msms[msm_idx];
@@ -182,7 +183,7 @@ class ECCVMMSMMBuilder {
                     }
                 }
             }
-        }
+        });
 
         // The execution trace data for the MSM columns requires knowledge of intermediate values from *affine* point
         // addition. The naive solution to compute this data requires 2 field inversions per in-circuit group addition
@@ -204,7 +205,8 @@ class ECCVMMSMMBuilder {
         std::span<Element> p2_trace(&points_to_normalize[num_point_adds_and_doubles], num_point_adds_and_doubles);
         std::span<Element> p3_trace(&points_to_normalize[num_point_adds_and_doubles * 2], num_point_adds_and_doubles);
         // operation_trace records whether an entry in the p1/p2/p3 trace represents a point addition or doubling
-        std::vector<bool> operation_trace(num_point_adds_and_doubles);
+        // (bytes rather than a std::vector<bool>, whose entries cannot be written from different threads)
+        std::vector<uint8_t> operation_trace(num_point_adds_and_doubles);
         // accumulator_trace tracks the value of the ECCVM accumulator for each row
         std::span<Element> accumulator_trace(&points_to_normalize[num_point_adds_and_doubles * 3], num_accumulators);
 
@@ -212,10 +214,10 @@ class ECCVMMSMMBuilder {
         constexpr auto offset_generator = bb::g1::derive_generators("ECCVM_OFFSET_GENERATOR", 1)[0];
         accumulator_trace[0] = offset_generator;
 
-        // TODO(https://github.com/AztecProtocol/barretenberg/issues/973): Reinstate multitreading?
         // populate point trace, and the components of the MSM execution trace that do not relate to affine point
-        // operations
-        for (size_t msm_idx = 0; msm_idx < msms.size(); msm_idx++) {
+        // operations. Every MSM starts from the offset generator and writes to its own rows (given by msm_row_counts),
+        // so the MSMs are processed concurrently
+        parallel_for_msms(msm_row_counts, num_msm_rows, [&](size_t msm_idx) {
             Element accumulator = offset_generator;
             const auto& msm = msms[msm_idx];
             size_t msm_row_index = msm_row_counts[msm_idx];
@@ -338,7 +340,7 @@ class ECCVMMSMMBuilder {
                     }
                 }
             }
-        }
+        });
 
         // Normalize the points in the point trace
         parallel_for_range(points_to_normalize.size(), [&](size_t start, size_t end) {
@@ -361,7 +363,7 @@ class ECCVMMSMMBuilder {
         // complete the computation of the ECCVM execution trace, by adding the affine intermediate point data
         // i.e. row.accumulator_x, row.accumulator_y, row.add_state[0...3].collision_inverse,
         // row.add_state[0...3].lambda
-        for (size_t msm_idx = 0; msm_idx < msms.size(); msm_idx++) {
+        parallel_for_msms(msm_row_counts, num_msm_rows, [&](size_t msm_idx) {
             const auto& msm = msms[msm_idx];
             size_t trace_index = ((msm_row_counts[msm_idx] - 1) * ADDITIONS_PER_ROW);
             size_t msm_row_index = msm_row_counts[msm_idx];
@@ -433,7 +435,7 @@ class ECCVMMSMMBuilder {
                     }
                 }
             }
-        }
+        });
 
         // populate the final row in the MSM execution trace.
         // we always require 1 extra row at the end of the trace, because the accumulator x/y coordinates for row `i`
@@ -456,5 +458,36 @@ class ECCVMMSMMBuilder {
 
         return { msm_rows, point_table_read_counts };
     }
+
+  private:
+    /**
+     * @brief Calls func(msm_idx) for every MSM, splitting the MSMs between threads so that each thread fills a similar
+     * number of rows
+     *
+     * @param msm_row_counts The row at which each MSM starts, followed by the row after the last MSM
+     * @param num_msm_rows
+     * @param func
+     */
+    template <typename Func>
+    static void parallel_for_msms(const std::vector<size_t>& msm_row_counts,
+                                  const size_t num_msm_rows,
+                                  const Func& func)
+    {
+        const size_t num_msms = msm_row_counts.size() - 1;
+        // the index of the first MSM starting at or after a row
+        const auto find_msm = [&](const size_t row_idx) {
+            const auto msm_starts_end = msm_row_counts.begin() + static_cast<std::ptrdiff_t>(num_msms);
+            return static_cast<size_t>(std::lower_bound(msm_row_counts.begin(), msm_starts_end, row_idx) -
+                                       msm_row_counts.begin());
+        };
+        const size_t num_threads = calculate_num_threads(num_msm_rows);
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            const size_t msm_start = find_msm(num_msm_rows * thread_idx / num_threads);
+            const size_t msm_end = find_msm(num_msm_rows * (thread_idx + 1) / num_threads);
+            for (size_t msm_idx = msm_start; msm_idx < msm_end; ++msm_idx) {
+                func(msm_idx);
+            }
+        });
+    }
 };
 } // namespace bb
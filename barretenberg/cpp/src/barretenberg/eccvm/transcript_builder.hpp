@@ -1,6 +1,7 @@
 #pragma once
 
 #include "./eccvm_builder_types.hpp"
+#include "barretenberg/common/thread.hpp"
 
 namespace bb {
 
@@ -110,6 +111,10 @@ class ECCVMTranscriptBuilder {
      * elliptic curve operations in Jacobian coordinates, and then normalizes these points to affine coordinates. Batch
      * inversion is used to optimize expensive finite field inversions.
      *
+     * Only the accumulators depend on the previous rows, and updating them takes at most a couple of point additions
+     * per row. The scalar multiplications, which dominate the cost, are computed concurrently before the loop, and the
+     * passes after it work on independent rows.
+     *
      * @param vm_operations ECCOpQueue
      * @param total_number_of_muls The total number of multiplications in the series of operations.
      *
@@ -149,6 +154,18 @@ class ECCVMTranscriptBuilder {
         // add an empty row. 1st row all zeroes because of our shiftable polynomials
         transcript_state[0] = (TranscriptRow{});
 
+        // the products of the base points and the full scalars, which do not depend on the state of the VM
+        std::vector<Element> mul_products(num_vm_entries);
+        parallel_for_heuristic(
+            num_vm_entries,
+            [&](size_t i) {
+                const VMOperation& entry = vm_operations[i];
+                if (entry.mul) {
+                    mul_products[i] = Element(entry.base_point) * entry.mul_scalar_full;
+                }
+            },
+            thread_heuristics::SM_COST);
+
         // during the first iteration over the ECCOpQueue, the operations are being performed using Jacobian
         // coordinates and the base point coordinates are recorded in the transcript. at the same time, the transcript
         // logic is being populated
@@ -194,7 +211,7 @@ class ECCVMTranscriptBuilder {
             updated_state.count = current_ongoing_msm ? state.count + num_muls : 0;
 
             if (is_mul) {
-                process_mul(entry, updated_state, state);
+                process_mul(mul_products[i], updated_state, state);
             }
 
             if (msm_transition) {
@@ -234,57 +251,62 @@ class ECCVMTranscriptBuilder {
 
         // process the slopes when adding points or results of MSMs. to increase efficiency, we use batch inversion
         // after the loop
-        for (size_t i = 0; i < accumulator_trace.size(); ++i) {
-            TranscriptRow& row = transcript_state[i + 1];
-            const bool msm_transition = row.msm_transition;
-
-            const VMOperation& entry = vm_operations[i];
-            const bool is_add = entry.add;
-
-            if (msm_transition || is_add) {
-                // compute the differences between point coordinates
-                compute_inverse_trace_coordinates(msm_transition,
-                                                  row,
-                                                  intermediate_accumulator_trace[i],
-                                                  transcript_msm_x_inverse_trace[i],
-                                                  msm_accumulator_trace[i],
-                                                  accumulator_trace[i],
-                                                  inverse_trace_x[i],
-                                                  inverse_trace_y[i]);
-
-                // compute the numerators and denominators of slopes between the points
-                compute_lambda_numerator_and_denominator(row,
-                                                         entry,
-                                                         intermediate_accumulator_trace[i],
-                                                         accumulator_trace[i],
-                                                         add_lambda_numerator[i],
-                                                         add_lambda_denominator[i]);
-            } else {
-                row.transcript_add_x_equal = 0;
-                row.transcript_add_y_equal = 0;
-                add_lambda_numerator[i] = 0;
-                add_lambda_denominator[i] = 0;
-                inverse_trace_x[i] = 0;
-                inverse_trace_y[i] = 0;
+        parallel_for_range(num_vm_entries, [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i) {
+                TranscriptRow& row = transcript_state[i + 1];
+                const bool msm_transition = row.msm_transition;
+
+                const VMOperation& entry = vm_operations[i];
+                const bool is_add = entry.add;
+
+                if (msm_transition || is_add) {
+                    // compute the differences between point coordinates
+                    compute_inverse_trace_coordinates(msm_transition,
+                                                      row,
+                                                      intermediate_accumulator_trace[i],
+                                                      transcript_msm_x_inverse_trace[i],
+                                                      msm_accumulator_trace[i],
+                                                      accumulator_trace[i],
+                                                      inverse_trace_x[i],
+                                                      inverse_trace_y[i]);
+
+                    // compute the numerators and denominators of slopes between the points
+                    compute_lambda_numerator_and_denominator(row,
+                                                             entry,
+                                                             intermediate_accumulator_trace[i],
+                                                             accumulator_trace[i],
+                                                             add_lambda_numerator[i],
+                                                             add_lambda_denominator[i]);
+                } else {
+                    row.transcript_add_x_equal = 0;
+                    row.transcript_add_y_equal = 0;
+                    add_lambda_numerator[i] = 0;
+                    add_lambda_denominator[i] = 0;
+                    inverse_trace_x[i] = 0;
+                    inverse_trace_y[i] = 0;
+                }
             }
-        }
+        });
 
         // Perform all required inversions at once
-        FF::batch_invert(&inverse_trace_x[0], num_vm_entries);
-        FF::batch_invert(&inverse_trace_y[0], num_vm_entries);
-        FF::batch_invert(&transcript_msm_x_inverse_trace[0], num_vm_entries);
-        FF::batch_invert(&add_lambda_denominator[0], num_vm_entries);
-        FF::batch_invert(&msm_count_at_transition_inverse_trace[0], num_vm_entries);
+        const std::array<std::span<FF>, 5> inverted_traces{ inverse_trace_x,
+                                                           inverse_trace_y,
+                                                           transcript_msm_x_inverse_trace,
+                                                           add_lambda_denominator,
+                                                           msm_count_at_transition_inverse_trace };
+        FF::parallel_batch_invert(inverted_traces);
 
         // Populate the fields of the transcript row containing inverted scalars
-        for (size_t i = 0; i < num_vm_entries; ++i) {
-            TranscriptRow& row = transcript_state[i + 1];
-            row.base_x_inverse = inverse_trace_x[i];
-            row.base_y_inverse = inverse_trace_y[i];
-            row.transcript_msm_x_inverse = transcript_msm_x_inverse_trace[i];
-            row.transcript_add_lambda = add_lambda_numerator[i] * add_lambda_denominator[i];
-            row.msm_count_at_transition_inverse = msm_count_at_transition_inverse_trace[i];
-        }
+        parallel_for_range(num_vm_entries, [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i) {
+                TranscriptRow& row = transcript_state[i + 1];
+                row.base_x_inverse = inverse_trace_x[i];
+                row.base_y_inverse = inverse_trace_y[i];
+                row.transcript_msm_x_inverse = transcript_msm_x_inverse_trace[i];
+                row.transcript_add_lambda = add_lambda_numerator[i] * add_lambda_denominator[i];
+                row.msm_count_at_transition_inverse = msm_count_at_transition_inverse_trace[i];
+            }
+        });
 
         // process the final row containing the result of the sequence of group ops in ECCOpQueue
         finalize_transcript(transcript_state, updated_state);
@@ -344,19 +366,17 @@ class ECCVMTranscriptBuilder {
     /**
      * @brief Process scalar multiplication from the ECCOpQueue.
      *
-     * @details If the entry indicates a multiplication operation, the
-     * base point from the ECCOpQueue is multiplied by the corresponding full scalar. The result is added to the
-     * 'msm_accumulator' field of the updated state.
+     * @details If the entry indicates a multiplication operation, the product of the base point from the ECCOpQueue and
+     * the corresponding full scalar is added to the 'msm_accumulator' field of the updated state.
      *
-     * @param entry Current ECCOpQueue entry
+     * @param product The base point of the current ECCOpQueue entry multiplied by its full scalar
      * @param updated_state The state of the ECCVM to be updated with the result of the multiplication
      * @param state The current state of the ECCVM
      */
-    static void process_mul(const VMOperation& entry, VMState& updated_state, const VMState& state)
+    static void process_mul(const Element& product, VMState& updated_state, const VMState& state)
     {
-        const auto P = typename CycleGroup::element(entry.base_point);
         const auto R = typename CycleGroup::element(state.msm_accumulator);
-        updated_state.msm_accumulator = R + P * entry.mul_scalar_full;
+        updated_state.msm_accumulator = R + product;
     }
 
     /**
@@ -417,9 +437,11 @@ class ECCVMTranscriptBuilder {
                                        Accumulator& msm_accumulator_trace,
                                        std::vector<Element>& intermediate_accumulator_trace)
     {
-        Element::batch_normalize(&accumulator_trace[0], accumulator_trace.size());
-        Element::batch_normalize(&msm_accumulator_trace[0], msm_accumulator_trace.size());
-        Element::batch_normalize(&intermediate_accumulator_trace[0], intermediate_accumulator_trace.size());
+        for (auto* trace : { &accumulator_trace, &msm_accumulator_trace, &intermediate_accumulator_trace }) {
+            parallel_for_range(trace->size(), [&](size_t start, size_t end) {
+                Element::batch_normalize(&(*trace)[start], end - start);
+            });
+        }
     }
     /**
      * @brief Once the point coordinates are converted from Jacobian to affine coordinates, we populate
@@ -435,21 +457,23 @@ class ECCVMTranscriptBuilder {
                                                      const Accumulator& msm_accumulator_trace,
                                                      const Accumulator& intermediate_accumulator_trace)
     {
-        for (size_t i = 0; i < accumulator_trace.size(); ++i) {
-            TranscriptRow& row = transcript_state[i + 1];
-            if (!accumulator_trace[i].is_point_at_infinity()) {
-                row.accumulator_x = accumulator_trace[i].x;
-                row.accumulator_y = accumulator_trace[i].y;
-            }
-            if (!msm_accumulator_trace[i].is_point_at_infinity()) {
-                row.msm_output_x = msm_accumulator_trace[i].x;
-                row.msm_output_y = msm_accumulator_trace[i].y;
-            }
-            if (!intermediate_accumulator_trace[i].is_point_at_infinity()) {
-                row.transcript_msm_intermediate_x = intermediate_accumulator_trace[i].x;
-                row.transcript_msm_intermediate_y = intermediate_accumulator_trace[i].y;
+        parallel_for_range(accumulator_trace.size(), [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i) {
+                TranscriptRow& row = transcript_state[i + 1];
+                if (!accumulator_trace[i].is_point_at_infinity()) {
+                    row.accumulator_x = accumulator_trace[i].x;
+                    row.accumulator_y = accumulator_trace[i].y;
+                }
+                if (!msm_accumulator_trace[i].is_point_at_infinity()) {
+                    row.msm_output_x = msm_accumulator_trace[i].x;
+                    row.msm_output_y = msm_accumulator_trace[i].y;
+                }
+                if (!intermediate_accumulator_trace[i].is_point_at_infinity()) {
+                    row.transcript_msm_intermediate_x = intermediate_accumulator_trace[i].x;
+                    row.transcript_msm_intermediate_y = intermediate_accumulator_trace[i].y;
+                }
             }
-        }
+        });
     }
     /**
      * @brief Compute the difference between the x and y coordinates of two points.
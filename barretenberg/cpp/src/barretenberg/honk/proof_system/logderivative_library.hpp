@@ -1,8 +1,12 @@
 #pragma once
 
 #include "barretenberg/common/constexpr_utils.hpp"
+#include "barretenberg/common/thread.hpp"
 
+#include <algorithm>
 #include <typeinfo>
+#include <utility>
+#include <vector>
 
 namespace bb {
 
@@ -24,21 +28,52 @@ namespace bb {
  *
  * The specific algebraic relations that define read terms and write terms are defined in Flavor::LookupRelation
  *
+ * Only the rows in the (non-overlapping) active ranges of the trace, if given, that are backed by the memory of the
+ * inverse polynomial are visited. If the polynomials provide a LazyRow, a row only reads the columns the relation
+ * accesses instead of copying every column with get_row.
+ *
  */
 template <typename FF, typename Relation, typename Polynomials>
-void compute_logderivative_inverse(Polynomials& polynomials, auto& relation_parameters, const size_t circuit_size)
+void compute_logderivative_inverse(Polynomials& polynomials,
+                                   auto& relation_parameters,
+                                   const size_t circuit_size,
+                                   const std::vector<std::pair<size_t, size_t>>& active_ranges = {})
 {
     using Accumulator = typename Relation::ValueAccumulator0;
     constexpr size_t READ_TERMS = Relation::READ_TERMS;
     constexpr size_t WRITE_TERMS = Relation::WRITE_TERMS;
 
     auto& inverse_polynomial = Relation::template get_inverse_polynomial(polynomials);
-    for (size_t i = 0; i < circuit_size; ++i) {
-        // TODO(https://github.com/AztecProtocol/barretenberg/issues/940): avoid get_row if possible.
-        auto row = polynomials.get_row(i);
-        bool has_inverse = Relation::operation_exists_at_row(row);
-        if (!has_inverse) {
-            continue;
+    // Only the rows backed by the memory of the inverse polynomial can hold an inverse
+    const size_t start = inverse_polynomial.start_index();
+    const size_t end = std::min(circuit_size, inverse_polynomial.end_index());
+
+    // The ranges of rows to visit, and the number of rows before each of them
+    std::vector<std::pair<size_t, size_t>> ranges;
+    std::vector<size_t> range_offsets;
+    size_t num_rows = 0;
+    const auto add_range = [&](size_t range_start, size_t range_end) {
+        range_start = std::max(range_start, start);
+        range_end = std::min(range_end, end);
+        if (range_start < range_end) {
+            ranges.emplace_back(range_start, range_end);
+            range_offsets.push_back(num_rows);
+            num_rows += range_end - range_start;
+        }
+    };
+    if (active_ranges.empty()) {
+        add_range(start, end);
+    }
+    for (const auto& [range_start, range_end] : active_ranges) {
+        add_range(range_start, range_end);
+    }
+    if (num_rows == 0) {
+        return;
+    }
+
+    const auto compute_denominator = [&](const auto& row, size_t i) {
+        if (!Relation::operation_exists_at_row(row)) {
+            return;
         }
         FF denominator = 1;
         bb::constexpr_for<0, READ_TERMS, 1>([&]<size_t read_index> {
@@ -54,9 +89,42 @@ void compute_logderivative_inverse(Polynomials& polynomials, auto& relation_para
         inverse_polynomial.at(i) = denominator;
     };
 
-    // Compute inverse polynomial I in place by inverting the product at each row
+    constexpr size_t ROW_COST = (READ_TERMS + WRITE_TERMS) * thread_heuristics::FF_MULTIPLICATION_COST;
+    parallel_for_heuristic(
+        num_rows,
+        [&](size_t chunk_start, size_t chunk_end, BB_UNUSED size_t chunk_index) {
+            // Visits the rows of the chunk, which may span several ranges
+            const auto for_each_row = [&](auto&& visit) {
+                size_t range_idx = static_cast<size_t>(
+                    std::upper_bound(range_offsets.begin(), range_offsets.end(), chunk_start) - range_offsets.begin() -
+                    1);
+                for (size_t offset = chunk_start; offset < chunk_end; ++range_idx) {
+                    const auto [range_start, range_end] = ranges[range_idx];
+                    const size_t first_row = range_start + (offset - range_offsets[range_idx]);
+                    const size_t last_row = std::min(range_end, first_row + (chunk_end - offset));
+                    for (size_t i = first_row; i < last_row; ++i) {
+                        visit(i);
+                    }
+                    offset += last_row - first_row;
+                }
+            };
+            if constexpr (requires { typename Polynomials::LazyRow; }) {
+                typename Polynomials::LazyRow row(polynomials);
+                for_each_row([&](size_t i) {
+                    row.set_row(i);
+                    compute_denominator(row, i);
+                });
+            } else {
+                for_each_row([&](size_t i) { compute_denominator(polynomials.get_row(i), i); });
+            }
+        },
+        ROW_COST);
+
+    // Compute the inverse polynomial I in place by inverting the product at each row
     // Note: zeroes are ignored as they are not used anyway
-    FF::batch_invert(inverse_polynomial.coeffs());
+    for (const auto& [range_start, range_end] : ranges) {
+        FF::parallel_batch_invert(inverse_polynomial.coeffs().subspan(range_start - start, range_end - range_start));
+    }
 }
 
 /**
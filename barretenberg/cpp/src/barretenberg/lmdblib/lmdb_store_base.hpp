@@ -4,6 +4,8 @@
 #include "barretenberg/lmdblib/lmdb_environment.hpp"
 #include "barretenberg/lmdblib/lmdb_read_transaction.hpp"
 #include "barretenberg/lmdblib/lmdb_write_transaction.hpp"
+#include <memory>
+#include <utility>
 
 namespace bb::lmdblib {
 class LMDBStoreBase {
@@ -18,6 +20,12 @@ class LMDBStoreBase {
     LMDBStoreBase& operator=(LMDBStoreBase&& other) noexcept = default;
     virtual ~LMDBStoreBase() = 0;
     ReadTransaction::Ptr create_read_transaction() const;
+    // Creates a read transaction of a type derived from ReadTransaction, constructed from the environment and args
+    template <typename Tx, typename... Args> std::unique_ptr<Tx> create_read_transaction(Args&&... args) const
+    {
+        _environment->wait_for_reader();
+        return std::make_unique<Tx>(_environment, std::forward<Args>(args)...);
+    }
     ReadTransaction::SharedPtr create_shared_read_transaction() const;
     WriteTransaction::Ptr create_write_transaction() const;
     LMDBDatabaseCreationTransaction::Ptr create_db_transaction() const;
@@ -45,4 +45,9 @@ bool LMDBTransaction::get_value(std::vector<uint8_t>& key, uint64_t& data, const
 {
     return lmdb_queries::get_value(key, data, db, *this);
 }
+
+bool LMDBTransaction::get_value(std::vector<uint8_t>& key, ValueView& data, const LMDBDatabase& db) const
+{
+    return lmdb_queries::get_value(key, data, db, *this);
+}
 } // namespace bb::lmdblib
\ No newline at end of file
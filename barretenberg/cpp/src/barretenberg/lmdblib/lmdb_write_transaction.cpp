@@ -28,11 +28,29 @@ void LMDBWriteTransaction::commit()
     }
     call_lmdb_func("mdb_txn_commit", mdb_txn_commit, _transaction);
     state = TransactionState::COMMITTED;
+    _abortCallbacks.clear();
 }
 
 void LMDBWriteTransaction::try_abort()
 {
+    abort();
+}
+
+void LMDBWriteTransaction::abort()
+{
+    if (state != TransactionState::OPEN) {
+        return;
+    }
     LMDBTransaction::abort();
+    for (const auto& callback : _abortCallbacks) {
+        callback();
+    }
+    _abortCallbacks.clear();
+}
+
+void LMDBWriteTransaction::on_abort(std::function<void()> callback)
+{
+    _abortCallbacks.emplace_back(std::move(callback));
 }
 
 void LMDBWriteTransaction::put_value(Key& key, Value& data, const LMDBDatabase& db)
@@ -9,7 +9,9 @@
 #include "lmdb.h"
 #include <cstdint>
 #include <exception>
+#include <functional>
 #include <memory>
+#include <vector>
 
 namespace bb::lmdblib {
 
@@ -54,6 +56,17 @@ class LMDBWriteTransaction : public LMDBTransaction {
     void commit();
 
     void try_abort();
+
+    void abort() override;
+
+    /**
+     * @brief Registers a function to call if the transaction is aborted, explicitly or on destruction, e.g. to roll
+     * back in-memory state derived from its writes. Must not throw.
+     */
+    void on_abort(std::function<void()> callback);
+
+  private:
+    std::vector<std::function<void()>> _abortCallbacks;
 };
 
 template <typename T> void LMDBWriteTransaction::put_value(T& key, Value& data, const LMDBDatabase& db)
@@ -114,6 +114,20 @@ bool get_value(Key& key, uint64_t& data, const LMDBDatabase& db, const bb::lmdbl
     return true;
 }
 
+bool get_value(Key& key, ValueView& data, const LMDBDatabase& db, const bb::lmdblib::LMDBTransaction& tx)
+{
+    MDB_val dbKey;
+    dbKey.mv_size = key.size();
+    dbKey.mv_data = (void*)key.data();
+
+    MDB_val dbVal;
+    if (!call_lmdb_func(mdb_get, tx.underlying(), db.underlying(), &dbKey, &dbVal)) {
+        return false;
+    }
+    data = ValueView(static_cast<const uint8_t*>(dbVal.mv_data), dbVal.mv_size);
+    return true;
+}
+
 bool set_at_key(const LMDBCursor& cursor, Key& key)
 {
     MDB_val dbKey;
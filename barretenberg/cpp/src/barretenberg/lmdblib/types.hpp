@@ -5,11 +5,14 @@
 #include <cstdint>
 #include <iostream>
 #include <optional>
+#include <span>
 #include <string>
 #include <vector>
 namespace bb::lmdblib {
 using Key = std::vector<uint8_t>;
 using Value = std::vector<uint8_t>;
+// A value in place on its LMDB page, valid until the transaction ends or writes to the database
+using ValueView = std::span<const uint8_t>;
 using KeysVector = std::vector<Key>;
 using ValuesVector = std::vector<Value>;
 using KeyValuesPair = std::pair<Key, ValuesVector>;
@@ -32,7 +32,14 @@ class MessageDispatcher {
     {
         bb::messaging::HeaderOnlyMessage header;
         obj.convert(header);
+        return on_new_data(header, obj, buffer);
+    }
 
+    // For callers that have already read the header of the message
+    bool on_new_data(const bb::messaging::HeaderOnlyMessage& header,
+                     msgpack::object& obj,
+                     msgpack::sbuffer& buffer) const
+    {
         auto iter = message_handlers.find(header.msgType);
         if (iter == message_handlers.end()) {
             throw std::runtime_error("No registered handler for message of type " + std::to_string(header.msgType));
@@ -1,4 +1,6 @@
 #include "barretenberg/nodejs_module/world_state/world_state.hpp"
+#include "barretenberg/common/stats.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/crypto/merkle_tree/hash_path.hpp"
 #include "barretenberg/crypto/merkle_tree/indexed_tree/indexed_leaf.hpp"
 #include "barretenberg/crypto/merkle_tree/response.hpp"
@@ -17,6 +19,7 @@
 #include <any>
 #include <array>
 #include <cstdint>
+#include <iomanip>
 #include <iostream>
 #include <memory>
 #include <optional>
@@ -32,6 +35,72 @@ using namespace bb::messaging;
 
 const uint64_t DEFAULT_MAP_SIZE = 1024UL * 1024;
 
+namespace {
+std::string get_message_type_name(uint32_t msgType)
+{
+    switch (msgType) {
+    case WorldStateMessageType::GET_TREE_INFO:
+        return "GET_TREE_INFO";
+    case WorldStateMessageType::GET_STATE_REFERENCE:
+        return "GET_STATE_REFERENCE";
+    case WorldStateMessageType::GET_INITIAL_STATE_REFERENCE:
+        return "GET_INITIAL_STATE_REFERENCE";
+    case WorldStateMessageType::GET_LEAF_VALUE:
+        return "GET_LEAF_VALUE";
+    case WorldStateMessageType::GET_LEAF_PREIMAGE:
+        return "GET_LEAF_PREIMAGE";
+    case WorldStateMessageType::GET_SIBLING_PATH:
+        return "GET_SIBLING_PATH";
+    case WorldStateMessageType::GET_BLOCK_NUMBERS_FOR_LEAF_INDICES:
+        return "GET_BLOCK_NUMBERS_FOR_LEAF_INDICES";
+    case WorldStateMessageType::FIND_LEAF_INDICES:
+        return "FIND_LEAF_INDICES";
+    case WorldStateMessageType::FIND_LOW_LEAF:
+        return "FIND_LOW_LEAF";
+    case WorldStateMessageType::APPEND_LEAVES:
+        return "APPEND_LEAVES";
+    case WorldStateMessageType::BATCH_INSERT:
+        return "BATCH_INSERT";
+    case WorldStateMessageType::SEQUENTIAL_INSERT:
+        return "SEQUENTIAL_INSERT";
+    case WorldStateMessageType::UPDATE_ARCHIVE:
+        return "UPDATE_ARCHIVE";
+    case WorldStateMessageType::COMMIT:
+        return "COMMIT";
+    case WorldStateMessageType::ROLLBACK:
+        return "ROLLBACK";
+    case WorldStateMessageType::SYNC_BLOCK:
+        return "SYNC_BLOCK";
+    case WorldStateMessageType::CREATE_FORK:
+        return "CREATE_FORK";
+    case WorldStateMessageType::DELETE_FORK:
+        return "DELETE_FORK";
+    case WorldStateMessageType::FINALISE_BLOCKS:
+        return "FINALISE_BLOCKS";
+    case WorldStateMessageType::UNWIND_BLOCKS:
+        return "UNWIND_BLOCKS";
+    case WorldStateMessageType::REMOVE_HISTORICAL_BLOCKS:
+        return "REMOVE_HISTORICAL_BLOCKS";
+    case WorldStateMessageType::GET_STATUS:
+        return "GET_STATUS";
+    case WorldStateMessageType::CREATE_CHECKPOINT:
+        return "CREATE_CHECKPOINT";
+    case WorldStateMessageType::COMMIT_CHECKPOINT:
+        return "COMMIT_CHECKPOINT";
+    case WorldStateMessageType::REVERT_CHECKPOINT:
+        return "REVERT_CHECKPOINT";
+    case WorldStateMessageType::GET_SIBLING_PATHS:
+        return "GET_SIBLING_PATHS";
+    case WorldStateMessageType::GET_STATS:
+        return "GET_STATS";
+    case WorldStateMessageType::WAIT_FOR_PERSISTED:
+        return "WAIT_FOR_PERSISTED";
+    default:
+        return "MESSAGE_" + std::to_string(msgType);
+    }
+}
+} // namespace
+
 WorldStateWrapper::WorldStateWrapper(const Napi::CallbackInfo& info)
     : ObjectWrap(info)
 {
@@ -180,6 +249,10 @@ WorldStateWrapper::WorldStateWrapper(const Napi::CallbackInfo& info)
         WorldStateMessageType::GET_SIBLING_PATH,
         [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return get_sibling_path(obj, buffer); });
 
+    _dispatcher.register_target(
+        WorldStateMessageType::GET_SIBLING_PATHS,
+        [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return get_sibling_paths(obj, buffer); });
+
     _dispatcher.register_target(WorldStateMessageType::GET_BLOCK_NUMBERS_FOR_LEAF_INDICES,
                                 [this](msgpack::object& obj, msgpack::sbuffer& buffer) {
                                     return get_block_numbers_for_leaf_indices(obj, buffer);
@@ -243,6 +316,14 @@ WorldStateWrapper::WorldStateWrapper(const Napi::CallbackInfo& info)
         WorldStateMessageType::GET_STATUS,
         [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return get_status(obj, buffer); });
 
+    _dispatcher.register_target(
+        WorldStateMessageType::GET_STATS,
+        [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return get_stats(obj, buffer); });
+
+    _dispatcher.register_target(
+        WorldStateMessageType::WAIT_FOR_PERSISTED,
+        [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return wait_for_persisted(obj, buffer); });
+
     _dispatcher.register_target(WorldStateMessageType::CLOSE,
                                 [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return close(obj, buffer); });
 
@@ -284,7 +365,17 @@ Napi::Value WorldStateWrapper::call(const Napi::CallbackInfo& info)
         auto* op = new AsyncOperation(env, deferred, [=, this](msgpack::sbuffer& buf) {
             msgpack::object_handle obj_handle = msgpack::unpack(data->data(), length);
             msgpack::object obj = obj_handle.get();
-            _dispatcher.on_new_data(obj, buf);
+            HeaderOnlyMessage header;
+            obj.convert(header);
+            // Time every message by type, these are reported by GET_STATS
+            bb::stats::ScopedBusyTimer timer;
+            try {
+                _dispatcher.on_new_data(header, obj, buf);
+            } catch (...) {
+                record_message(header.msgType, timer.stop());
+                throw;
+            }
+            record_message(header.msgType, timer.stop());
         });
 
         // Napi is now responsible for destroying this object
@@ -434,6 +525,29 @@ bool WorldStateWrapper::get_sibling_path(msgpack::object& obj, msgpack::sbuffer&
     return true;
 }
 
+bool WorldStateWrapper::get_sibling_paths(msgpack::object& obj, msgpack::sbuffer& buffer) const
+{
+    TypedMessage<GetSiblingPathsRequest> request;
+    obj.convert(request);
+
+    std::vector<bb::crypto::merkle_tree::GetSiblingPathsResponse> results =
+        _ws->get_sibling_paths(request.value.revision, request.value.queries);
+
+    GetSiblingPathsResponse response;
+    response.trees.reserve(results.size());
+    for (auto& result : results) {
+        response.trees.push_back({ .paths = std::move(result.paths), .leaves = std::move(result.leaves) });
+    }
+
+    MsgHeader header(request.header.messageId);
+    messaging::TypedMessage<GetSiblingPathsResponse> resp_msg(
+        WorldStateMessageType::GET_SIBLING_PATHS, header, response);
+
+    msgpack::pack(buffer, resp_msg);
+
+    return true;
+}
+
 bool WorldStateWrapper::get_block_numbers_for_leaf_indices(msgpack::object& obj, msgpack::sbuffer& buffer) const
 {
     TypedMessage<GetBlockNumbersForLeafIndicesRequest> request;
@@ -670,7 +784,8 @@ bool WorldStateWrapper::sync_block(msgpack::object& obj, msgpack::sbuffer& buf)
                                                   request.value.paddedNoteHashes,
                                                   request.value.paddedL1ToL2Messages,
                                                   request.value.paddedNullifiers,
-                                                  request.value.publicDataWrites);
+                                                  request.value.publicDataWrites,
+                                                  request.value.waitForPersisted);
 
     MsgHeader header(request.header.messageId);
     messaging::TypedMessage<WorldStateStatusFull> resp_msg(WorldStateMessageType::SYNC_BLOCK, header, { status });
@@ -679,6 +794,20 @@ bool WorldStateWrapper::sync_block(msgpack::object& obj, msgpack::sbuffer& buf)
     return true;
 }
 
+bool WorldStateWrapper::wait_for_persisted(msgpack::object& obj, msgpack::sbuffer& buf)
+{
+    HeaderOnlyMessage request;
+    obj.convert(request);
+
+    _ws->wait_for_persisted_commit();
+
+    MsgHeader header(request.header.messageId);
+    messaging::TypedMessage<EmptyResponse> resp_msg(WorldStateMessageType::WAIT_FOR_PERSISTED, header, {});
+    msgpack::pack(buf, resp_msg);
+
+    return true;
+}
+
 bool WorldStateWrapper::create_fork(msgpack::object& obj, msgpack::sbuffer& buf)
 {
     TypedMessage<CreateForkRequest> request;
@@ -717,7 +846,17 @@ bool WorldStateWrapper::close(msgpack::object& obj, msgpack::sbuffer& buf)
 
     // The only reason this API exists is for testing purposes in TS (e.g. close db, open new db instance to test
     // persistence)
+    // A block still being written is finished first, if that fails the world state is closed all the same
+    std::optional<std::string> error;
+    try {
+        _ws->wait_for_persisted_commit();
+    } catch (std::exception& e) {
+        error = e.what();
+    }
     _ws.reset(nullptr);
+    if (error.has_value()) {
+        throw std::runtime_error(error.value());
+    }
 
     MsgHeader header(request.header.messageId);
     messaging::TypedMessage<EmptyResponse> resp_msg(WorldStateMessageType::CLOSE, header, {});
@@ -824,6 +963,60 @@ bool WorldStateWrapper::get_status(msgpack::object& obj, msgpack::sbuffer& buf)
     return true;
 }
 
+void WorldStateWrapper::record_message(uint32_t msgType, const bb::stats::ScopedBusyTimer::Times& times)
+{
+    if (msgType < FIRST_APP_MSG_TYPE || msgType - FIRST_APP_MSG_TYPE >= _messageStats.size()) {
+        return;
+    }
+    MessageStats& stats = _messageStats[msgType - FIRST_APP_MSG_TYPE];
+    stats.count.fetch_add(1, std::memory_order_relaxed);
+    stats.wallNs.fetch_add(times.wall_ns, std::memory_order_relaxed);
+    bb::stats::fetch_max(stats.maxWallNs, times.wall_ns);
+    stats.busyNs.fetch_add(times.busy_ns, std::memory_order_relaxed);
+}
+
+/**
+ * Reports, as JSON, the peak memory usage and thread count of the process and, for each message type handled so far,
+ * the number of messages, the wall time spent on them and the share of the parallel_for threads busy meanwhile. E.g.
+ * {"num_threads":16,"peak_rss_bytes":1024,"messages":{"SYNC_BLOCK":{"count":1,"wall_ms":2.500,"max_wall_ms":2.500,
+ * "utilization":0.125}}}
+ */
+bool WorldStateWrapper::get_stats(msgpack::object& obj, msgpack::sbuffer& buf)
+{
+    TypedMessage<GetStatsRequest> request;
+    obj.convert(request);
+
+    constexpr double NS_PER_MS = 1e6;
+    std::ostringstream os;
+    os << std::fixed << std::setprecision(3);
+    const size_t numThreads = bb::get_num_cpus();
+    os << "{\"num_threads\":" << numThreads << ",\"peak_rss_bytes\":" << bb::stats::peak_rss_bytes()
+       << ",\"messages\":{";
+    bool first = true;
+    for (uint32_t i = 0; i < _messageStats.size(); ++i) {
+        MessageStats& stats = _messageStats[i];
+        const uint64_t count = request.value.reset ? stats.count.exchange(0) : stats.count.load();
+        const uint64_t wallNs = request.value.reset ? stats.wallNs.exchange(0) : stats.wallNs.load();
+        const uint64_t maxWallNs = request.value.reset ? stats.maxWallNs.exchange(0) : stats.maxWallNs.load();
+        const uint64_t busyNs = request.value.reset ? stats.busyNs.exchange(0) : stats.busyNs.load();
+        if (count == 0) {
+            continue;
+        }
+        os << (first ? "" : ",") << "\"" << get_message_type_name(FIRST_APP_MSG_TYPE + i) << "\":{\"count\":" << count
+           << ",\"wall_ms\":" << static_cast<double>(wallNs) / NS_PER_MS
+           << ",\"max_wall_ms\":" << static_cast<double>(maxWallNs) / NS_PER_MS
+           << ",\"utilization\":" << bb::stats::utilization(wallNs, busyNs, numThreads) << "}";
+        first = false;
+    }
+    os << "}}";
+
+    MsgHeader header(request.header.messageId);
+    messaging::TypedMessage<GetStatsResponse> resp_msg(WorldStateMessageType::GET_STATS, header, { os.str() });
+    msgpack::pack(buf, resp_msg);
+
+    return true;
+}
+
 Napi::Function WorldStateWrapper::get_class(Napi::Env env)
 {
     return DefineClass(env,
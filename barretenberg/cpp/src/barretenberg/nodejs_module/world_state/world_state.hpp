@@ -1,9 +1,12 @@
 #pragma once
 
+#include "barretenberg/common/stats.hpp"
 #include "barretenberg/messaging/dispatcher.hpp"
 #include "barretenberg/nodejs_module/world_state/world_state_message.hpp"
 #include "barretenberg/world_state/types.hpp"
 #include "barretenberg/world_state/world_state.hpp"
+#include <array>
+#include <atomic>
 #include <cstdint>
 #include <memory>
 #include <napi.h>
@@ -28,8 +31,20 @@ class WorldStateWrapper : public Napi::ObjectWrap<WorldStateWrapper> {
     static Napi::Function get_class(Napi::Env);
 
   private:
+    // The number of messages of a type handled and the wall time spent on them
+    struct MessageStats {
+        std::atomic<uint64_t> count = 0;
+        std::atomic<uint64_t> wallNs = 0;
+        std::atomic<uint64_t> maxWallNs = 0;
+        std::atomic<uint64_t> busyNs = 0;
+    };
+
     std::unique_ptr<bb::world_state::WorldState> _ws;
     bb::messaging::MessageDispatcher _dispatcher;
+    // Indexed by message type from FIRST_APP_MSG_TYPE, CLOSE is not recorded
+    std::array<MessageStats, NUM_SEQUENTIAL_MESSAGE_TYPES> _messageStats;
+
+    void record_message(uint32_t msgType, const bb::stats::ScopedBusyTimer::Times& times);
 
     bool get_tree_info(msgpack::object& obj, msgpack::sbuffer& buffer) const;
     bool get_state_reference(msgpack::object& obj, msgpack::sbuffer& buffer) const;
@@ -38,6 +53,7 @@ class WorldStateWrapper : public Napi::ObjectWrap<WorldStateWrapper> {
     bool get_leaf_value(msgpack::object& obj, msgpack::sbuffer& buffer) const;
     bool get_leaf_preimage(msgpack::object& obj, msgpack::sbuffer& buffer) const;
     bool get_sibling_path(msgpack::object& obj, msgpack::sbuffer& buffer) const;
+    bool get_sibling_paths(msgpack::object& obj, msgpack::sbuffer& buffer) const;
     bool get_block_numbers_for_leaf_indices(msgpack::object& obj, msgpack::sbuffer& buffer) const;
 
     bool find_leaf_indices(msgpack::object& obj, msgpack::sbuffer& buffer) const;
@@ -53,6 +69,7 @@ class WorldStateWrapper : public Napi::ObjectWrap<WorldStateWrapper> {
     bool rollback(msgpack::object& obj, msgpack::sbuffer& buffer);
 
     bool sync_block(msgpack::object& obj, msgpack::sbuffer& buffer);
+    bool wait_for_persisted(msgpack::object& obj, msgpack::sbuffer& buffer);
 
     bool create_fork(msgpack::object& obj, msgpack::sbuffer& buffer);
     bool delete_fork(msgpack::object& obj, msgpack::sbuffer& buffer);
@@ -64,6 +81,7 @@ class WorldStateWrapper : public Napi::ObjectWrap<WorldStateWrapper> {
     bool remove_historical(msgpack::object& obj, msgpack::sbuffer& buffer) const;
 
     bool get_status(msgpack::object& obj, msgpack::sbuffer& buffer) const;
+    bool get_stats(msgpack::object& obj, msgpack::sbuffer& buffer);
 
     bool checkpoint(msgpack::object& obj, msgpack::sbuffer& buffer);
     bool commit_checkpoint(msgpack::object& obj, msgpack::sbuffer& buffer);
@@ -52,9 +52,18 @@ enum WorldStateMessageType {
     COMMIT_CHECKPOINT,
     REVERT_CHECKPOINT,
 
+    GET_SIBLING_PATHS,
+
+    GET_STATS,
+
+    WAIT_FOR_PERSISTED,
+
     CLOSE = 999,
 };
 
+// The number of message types numbered from FIRST_APP_MSG_TYPE, i.e. all but CLOSE
+const uint32_t NUM_SEQUENTIAL_MESSAGE_TYPES = WAIT_FOR_PERSISTED + 1 - FIRST_APP_MSG_TYPE;
+
 struct TreeIdOnlyRequest {
     MerkleTreeId treeId;
     MSGPACK_FIELDS(treeId);
@@ -142,6 +151,35 @@ struct GetSiblingPathRequest {
     MSGPACK_FIELDS(treeId, revision, leafIndex);
 };
 
+struct GetSiblingPathsRequest {
+    WorldStateRevision revision;
+    std::vector<TreeLeafIndices> queries;
+    MSGPACK_FIELDS(revision, queries);
+};
+
+struct TreeSiblingPaths {
+    std::vector<fr_sibling_path> paths;
+    std::vector<std::optional<fr>> leaves;
+    MSGPACK_FIELDS(paths, leaves);
+};
+
+struct GetSiblingPathsResponse {
+    std::vector<TreeSiblingPaths> trees;
+    MSGPACK_FIELDS(trees);
+};
+
+struct GetStatsRequest {
+    // Whether to zero the statistics once read
+    bool reset;
+    MSGPACK_FIELDS(reset);
+};
+
+struct GetStatsResponse {
+    // The statistics as JSON, see WorldStateWrapper::get_stats
+    std::string stats;
+    MSGPACK_FIELDS(stats);
+};
+
 struct GetBlockNumbersForLeafIndicesRequest {
     MerkleTreeId treeId;
     WorldStateRevision revision;
@@ -221,6 +259,8 @@ struct SyncBlockRequest {
     std::vector<bb::fr> paddedNoteHashes, paddedL1ToL2Messages;
     std::vector<crypto::merkle_tree::NullifierLeafValue> paddedNullifiers;
     std::vector<crypto::merkle_tree::PublicDataLeafValue> publicDataWrites;
+    // Whether to respond once the block is written to disk, rather than once it is committed in memory
+    bool waitForPersisted = true;
 
     MSGPACK_FIELDS(blockNumber,
                    blockStateRef,
@@ -228,7 +268,8 @@ struct SyncBlockRequest {
                    paddedNoteHashes,
                    paddedL1ToL2Messages,
                    paddedNullifiers,
-                   publicDataWrites);
+                   publicDataWrites,
+                   waitForPersisted);
 };
 
 } // namespace bb::nodejs
@@ -9,6 +9,7 @@
 
 #include "barretenberg/common/ref_span.hpp"
 #include "barretenberg/common/ref_vector.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/flavor/flavor.hpp"
 #include "barretenberg/plonk/proof_system/proving_key/proving_key.hpp"
@@ -18,6 +19,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <initializer_list>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
@@ -119,7 +121,25 @@ template <size_t NUM_WIRES, bool generalized> struct PermutationMapping {
     }
 };
 
-using CyclicPermutation = std::vector<cycle_node>;
+using CyclicPermutation = std::span<const cycle_node>;
+
+/**
+ * @brief The copy cycles of a circuit, one for each variable, stored back to back in a single array
+ * @details The nodes of the i-th cycle are nodes[offsets[i]], ..., nodes[offsets[i + 1] - 1]. Most circuits have about
+ * as many variables as gates, so storing the cycles flat avoids an allocation per variable and allows them to be
+ * constructed in parallel.
+ */
+struct CopyCycles {
+    std::vector<cycle_node> nodes;
+    std::vector<size_t> offsets; // one more entry than the number of cycles
+
+    size_t size() const { return offsets.empty() ? 0 : offsets.size() - 1; }
+
+    CyclicPermutation operator[](size_t cycle_idx) const
+    {
+        return CyclicPermutation(nodes).subspan(offsets[cycle_idx], offsets[cycle_idx + 1] - offsets[cycle_idx]);
+    }
+};
 
 namespace {
 /**
@@ -138,7 +158,7 @@ template <typename Flavor, bool generalized>
 PermutationMapping<Flavor::NUM_WIRES, generalized> compute_permutation_mapping(
     const typename Flavor::CircuitBuilder& circuit_constructor,
     typename Flavor::ProvingKey* proving_key,
-    const std::vector<CyclicPermutation>& wire_copy_cycles)
+    const CopyCycles& wire_copy_cycles)
 {
 
     // Initialize the table of permutations so that every element points to itself
@@ -147,43 +167,46 @@ PermutationMapping<Flavor::NUM_WIRES, generalized> compute_permutation_mapping(
     // Represents the idx of a variable in circuit_constructor.variables (needed only for generalized)
     std::span<const uint32_t> real_variable_tags = circuit_constructor.real_variable_tags;
 
-    // Go through each cycle
-    for (size_t cycle_idx = 0; cycle_idx < wire_copy_cycles.size(); ++cycle_idx) {
-        const CyclicPermutation& cycle = wire_copy_cycles[cycle_idx];
-        for (size_t node_idx = 0; node_idx < cycle.size(); ++node_idx) {
-            // Get the indices (column, row) of the current node in the cycle
-            const cycle_node& current_node = cycle[node_idx];
-            const auto current_row = static_cast<ptrdiff_t>(current_node.gate_idx);
-            const auto current_column = current_node.wire_idx;
-
-            // Get indices of next node; If the current node is last in the cycle, then the next is the first one
-            size_t next_node_idx = (node_idx == cycle.size() - 1 ? 0 : node_idx + 1);
-            const cycle_node& next_node = cycle[next_node_idx];
-            const auto next_row = next_node.gate_idx;
-            const auto next_column = static_cast<uint8_t>(next_node.wire_idx);
-
-            // Point current node to the next node
-            mapping.sigmas[current_column].row_idx[current_row] = next_row;
-            mapping.sigmas[current_column].col_idx[current_row] = next_column;
-
-            if constexpr (generalized) {
-                const bool first_node = (node_idx == 0);
-                const bool last_node = (next_node_idx == 0);
-
-                if (first_node) {
-                    mapping.ids[current_column].is_tag[current_row] = true;
-                    mapping.ids[current_column].row_idx[current_row] = real_variable_tags[cycle_idx];
-                }
-                if (last_node) {
-                    mapping.sigmas[current_column].is_tag[current_row] = true;
+    // Go through each cycle. Every node belongs to exactly one cycle, so the cycles can be processed in parallel.
+    parallel_for_heuristic(
+        wire_copy_cycles.size(),
+        [&](size_t cycle_idx) {
+            const CyclicPermutation cycle = wire_copy_cycles[cycle_idx];
+            for (size_t node_idx = 0; node_idx < cycle.size(); ++node_idx) {
+                // Get the indices (column, row) of the current node in the cycle
+                const cycle_node& current_node = cycle[node_idx];
+                const auto current_row = static_cast<ptrdiff_t>(current_node.gate_idx);
+                const auto current_column = current_node.wire_idx;
+
+                // Get indices of next node; If the current node is last in the cycle, then the next is the first one
+                size_t next_node_idx = (node_idx == cycle.size() - 1 ? 0 : node_idx + 1);
+                const cycle_node& next_node = cycle[next_node_idx];
+                const auto next_row = next_node.gate_idx;
+                const auto next_column = static_cast<uint8_t>(next_node.wire_idx);
+
+                // Point current node to the next node
+                mapping.sigmas[current_column].row_idx[current_row] = next_row;
+                mapping.sigmas[current_column].col_idx[current_row] = next_column;
+
+                if constexpr (generalized) {
+                    const bool first_node = (node_idx == 0);
+                    const bool last_node = (next_node_idx == 0);
+
+                    if (first_node) {
+                        mapping.ids[current_column].is_tag[current_row] = true;
+                        mapping.ids[current_column].row_idx[current_row] = real_variable_tags[cycle_idx];
+                    }
+                    if (last_node) {
+                        mapping.sigmas[current_column].is_tag[current_row] = true;
 
-                    // TODO(Zac): yikes, std::maps (tau) are expensive. Can we find a way to get rid of this?
-                    mapping.sigmas[current_column].row_idx[current_row] =
-                        circuit_constructor.tau.at(real_variable_tags[cycle_idx]);
+                        // TODO(Zac): yikes, std::maps (tau) are expensive. Can we find a way to get rid of this?
+                        mapping.sigmas[current_column].row_idx[current_row] =
+                            circuit_constructor.tau.at(real_variable_tags[cycle_idx]);
+                    }
                 }
             }
-        }
-    }
+        },
+        thread_heuristics::FF_COPY_COST * Flavor::NUM_WIRES);
 
     // Add information about public inputs so that the cycles can be altered later; See the construction of the
     // permutation polynomials for details.
@@ -420,7 +443,7 @@ inline std::tuple<LegacyPolynomial<FF>, LegacyPolynomial<FF>> compute_first_and_
 template <typename Flavor>
 void compute_permutation_argument_polynomials(const typename Flavor::CircuitBuilder& circuit,
                                               typename Flavor::ProvingKey* key,
-                                              const std::vector<CyclicPermutation>& copy_cycles)
+                                              const CopyCycles& copy_cycles)
 {
     constexpr bool generalized = IsUltraPlonkOrHonk<Flavor>;
     auto mapping = compute_permutation_mapping<Flavor, generalized>(circuit, key, copy_cycles);
@@ -2,6 +2,7 @@
 #include "barretenberg/common/mem.hpp"
 #include "barretenberg/common/ref_array.hpp"
 #include "barretenberg/common/slab_allocator.hpp"
+#include "barretenberg/plonk_honk_shared/execution_trace/selector.hpp"
 #include <cstddef>
 
 #ifdef CHECK_CIRCUIT_STACKTRACES
@@ -39,7 +40,7 @@ template <typename FF, size_t NUM_WIRES_, size_t NUM_SELECTORS_> class Execution
     static constexpr size_t NUM_WIRES = NUM_WIRES_;
     static constexpr size_t NUM_SELECTORS = NUM_SELECTORS_;
 
-    using SelectorType = SlabVector<FF>;
+    using SelectorType = Selector<FF>;
     using WireType = SlabVector<uint32_t>;
     using Selectors = std::array<SelectorType, NUM_SELECTORS>;
     using Wires = std::array<WireType, NUM_WIRES>;
@@ -0,0 +1,182 @@
+#pragma once
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/slab_allocator.hpp"
+#include "barretenberg/numeric/uint256/uint256.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <vector>
+
+namespace bb {
+
+/**
+ * @brief Compact storage of the values of a selector over the gates of a block
+ * @details Most selector values are small integers: the gate selectors are 0/1 flags (or a small gate kind), and most
+ * arithmetic coefficients are 0, 1 or -1. Each row stores its value as a signed byte, except for rows whose value does
+ * not fit, which store the LARGE_VALUE code and whose rows and values are kept, ordered by row, in separate lists. This
+ * takes a byte per row instead of the 32 bytes of a field element.
+ *
+ * The representation is canonical (a value is in the lists if and only if it does not fit in a byte), so two selectors
+ * are equal if and only if their members are.
+ *
+ * @tparam FF
+ */
+template <typename FF> class Selector {
+  public:
+    // The code of the rows whose value is in the list of large values
+    static constexpr int8_t LARGE_VALUE = std::numeric_limits<int8_t>::min();
+
+    size_t size() const { return small_values.size(); }
+
+    void reserve(size_t size_hint) { small_values.reserve(size_hint); }
+
+    void emplace_back(const FF& value)
+    {
+        const std::optional<int8_t> small_value = to_small_value(value);
+        if (!small_value.has_value()) {
+            large_value_rows.emplace_back(static_cast<uint32_t>(size()));
+            large_values.emplace_back(value);
+        }
+        small_values.emplace_back(small_value.value_or(LARGE_VALUE));
+    }
+
+    void push_back(const FF& value) { emplace_back(value); }
+
+    /**
+     * @brief Resizes the selector, padding it with zeros if it grows
+     */
+    void resize(size_t new_size)
+    {
+        if (new_size < size()) {
+            const size_t num_large_values = find_large_value(new_size);
+            large_value_rows.resize(num_large_values);
+            large_values.resize(num_large_values);
+        }
+        small_values.resize(new_size, 0);
+    }
+
+    // Values are decoded on read, so they are returned const: assigning to one would not change the selector, see set()
+    // NOLINTNEXTLINE(readability-const-return-type)
+    const FF operator[](size_t row) const
+    {
+        ASSERT(row < size());
+        const int8_t small_value = small_values[row];
+        if (small_value != LARGE_VALUE) {
+            return get_small_field_values()[static_cast<uint8_t>(small_value)];
+        }
+        return large_values[find_large_value(row)];
+    }
+
+    // NOLINTNEXTLINE(readability-const-return-type)
+    const FF back() const { return (*this)[size() - 1]; }
+
+    /**
+     * @brief Sets the value at a row. Setting a row that held a large value, or setting a large value at a row other
+     * than the last, moves the list of large values and should be reserved for the last rows of a block.
+     */
+    void set(size_t row, const FF& value)
+    {
+        ASSERT(row < size());
+        const std::optional<int8_t> small_value = to_small_value(value);
+        const auto large_value_idx = static_cast<std::ptrdiff_t>(find_large_value(row));
+        if (small_values[row] == LARGE_VALUE) {
+            if (!small_value.has_value()) {
+                large_values[static_cast<size_t>(large_value_idx)] = value;
+                return;
+            }
+            large_value_rows.erase(large_value_rows.begin() + large_value_idx);
+            large_values.erase(large_values.begin() + large_value_idx);
+        } else if (!small_value.has_value()) {
+            large_value_rows.insert(large_value_rows.begin() + large_value_idx, static_cast<uint32_t>(row));
+            large_values.insert(large_values.begin() + large_value_idx, value);
+        }
+        small_values[row] = small_value.value_or(LARGE_VALUE);
+    }
+
+    void set_back(const FF& value) { set(size() - 1, value); }
+
+    /**
+     * @brief Calls write(row, value) for each row in [start, end), in order of the rows
+     * @details Used to expand the selector into a polynomial without searching the large values of every row
+     */
+    template <typename Func> void for_each_value(size_t start, size_t end, const Func& write) const
+    {
+        ASSERT(start <= end && end <= size());
+        const auto& small_field_values = get_small_field_values();
+        size_t large_value_idx = find_large_value(start);
+        for (size_t row = start; row < end; ++row) {
+            const int8_t small_value = small_values[row];
+            if (small_value != LARGE_VALUE) {
+                write(row, small_field_values[static_cast<uint8_t>(small_value)]);
+            } else {
+                write(row, large_values[large_value_idx++]);
+            }
+        }
+    }
+
+    std::vector<FF> to_vector() const
+    {
+        std::vector<FF> result;
+        result.reserve(size());
+        for_each_value(0, size(), [&](size_t, const FF& value) { result.emplace_back(value); });
+        return result;
+    }
+
+    // Number of bytes held by the selector
+    size_t memory_usage() const
+    {
+        return small_values.capacity() * sizeof(int8_t) + large_value_rows.capacity() * sizeof(uint32_t) +
+               large_values.capacity() * sizeof(FF);
+    }
+
+    bool operator==(const Selector& other) const = default;
+
+  private:
+    SlabVector<int8_t> small_values;
+    SlabVector<uint32_t> large_value_rows; // ordered
+    SlabVector<FF> large_values;
+
+    static std::optional<int8_t> to_small_value(const FF& value)
+    {
+        if (value.is_zero()) {
+            return 0;
+        }
+        if (value == FF::one()) {
+            return 1;
+        }
+        const auto integer = static_cast<uint256_t>(value);
+        if (integer <= static_cast<uint256_t>(std::numeric_limits<int8_t>::max())) {
+            return static_cast<int8_t>(integer.data[0]);
+        }
+        const auto negated = static_cast<uint256_t>(-value);
+        if (negated <= static_cast<uint256_t>(std::numeric_limits<int8_t>::max())) {
+            return static_cast<int8_t>(-static_cast<int8_t>(negated.data[0]));
+        }
+        return std::nullopt;
+    }
+
+    // The field element of each code, indexed by the code as an unsigned byte
+    static const std::array<FF, 256>& get_small_field_values()
+    {
+        static const std::array<FF, 256> small_field_values = [] {
+            std::array<FF, 256> values;
+            for (int code = std::numeric_limits<int8_t>::min(); code <= std::numeric_limits<int8_t>::max(); ++code) {
+                values[static_cast<uint8_t>(code)] = FF(code);
+            }
+            return values;
+        }();
+        return small_field_values;
+    }
+
+    // The index of the first large value at or after a row
+    size_t find_large_value(size_t row) const
+    {
+        return static_cast<size_t>(std::lower_bound(large_value_rows.begin(), large_value_rows.end(), row) -
+                                   large_value_rows.begin());
+    }
+};
+
+} // namespace bb
@@ -0,0 +1,111 @@
+#include "barretenberg/plonk_honk_shared/execution_trace/selector.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+
+#include <gtest/gtest.h>
+#include <type_traits>
+#include <utility>
+
+using namespace bb;
+
+namespace {
+auto& engine = numeric::get_debug_randomness();
+}
+
+// Reads return decoded copies, writing to one must not compile as it would not change the selector (see set())
+static_assert(!std::is_assignable_v<decltype(std::declval<Selector<fr>&>()[0]), fr>);
+static_assert(!std::is_assignable_v<decltype(std::declval<Selector<fr>&>().back()), fr>);
+
+class SelectorTest : public ::testing::Test {
+  protected:
+    using FF = fr;
+
+    // A mix of small values (including the extremes that fit in a byte) and values that do not fit
+    static std::vector<FF> sample_values()
+    {
+        return { 0, 1, -1, 3, 127, -127, 128, -128, FF::random_element(&engine), 2, FF::random_element(&engine), 0 };
+    }
+};
+
+TEST_F(SelectorTest, StoresSmallAndLargeValues)
+{
+    std::vector<FF> values = sample_values();
+    Selector<FF> selector;
+    for (const FF& value : values) {
+        selector.emplace_back(value);
+    }
+
+    EXPECT_EQ(selector.size(), values.size());
+    for (size_t row = 0; row < values.size(); ++row) {
+        EXPECT_EQ(selector[row], values[row]);
+    }
+    EXPECT_EQ(selector.back(), values.back());
+    EXPECT_EQ(selector.to_vector(), values);
+    // A byte per row, and the four values that do not fit with their rows
+    EXPECT_LT(selector.memory_usage(), values.size() + 8 * (sizeof(uint32_t) + sizeof(FF)));
+}
+
+TEST_F(SelectorTest, SetMovesValuesBetweenRepresentations)
+{
+    std::vector<FF> values = sample_values();
+    Selector<FF> selector;
+    for (const FF& value : values) {
+        selector.emplace_back(value);
+    }
+
+    // Small to large, large to small and large to large, in the middle and at the end
+    values[2] = FF::random_element(&engine);
+    values[6] = 5;
+    values[8] = FF::random_element(&engine);
+    values.back() = FF::random_element(&engine);
+    selector.set(2, values[2]);
+    selector.set(6, values[6]);
+    selector.set(8, values[8]);
+    selector.set_back(values.back());
+    EXPECT_EQ(selector.to_vector(), values);
+
+    // The representation is canonical, so a selector built directly from the values is equal
+    Selector<FF> expected;
+    for (const FF& value : values) {
+        expected.push_back(value);
+    }
+    EXPECT_EQ(selector, expected);
+}
+
+TEST_F(SelectorTest, ResizeDropsOrPadsRows)
+{
+    std::vector<FF> values = sample_values();
+    Selector<FF> selector;
+    for (const FF& value : values) {
+        selector.emplace_back(value);
+    }
+
+    selector.resize(7);
+    values.resize(7);
+    EXPECT_EQ(selector.to_vector(), values);
+
+    selector.resize(10);
+    values.resize(10, 0);
+    EXPECT_EQ(selector.to_vector(), values);
+
+    // Values appended after a shrink are found at their rows
+    FF large_value = FF::random_element(&engine);
+    selector.emplace_back(large_value);
+    EXPECT_EQ(selector[10], large_value);
+}
+
+TEST_F(SelectorTest, VisitsTheValuesOfARange)
+{
+    std::vector<FF> values = sample_values();
+    Selector<FF> selector;
+    for (const FF& value : values) {
+        selector.emplace_back(value);
+    }
+
+    std::vector<size_t> rows;
+    selector.for_each_value(5, 11, [&](size_t row, const FF& value) {
+        rows.push_back(row);
+        EXPECT_EQ(value, values[row]);
+    });
+    EXPECT_EQ(rows, std::vector<size_t>({ 5, 6, 7, 8, 9, 10 }));
+}
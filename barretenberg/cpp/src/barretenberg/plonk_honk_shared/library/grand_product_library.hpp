@@ -162,11 +162,11 @@ void compute_grand_product(typename Flavor::ProverPolynomials& full_polynomials,
                 denominator.at(i) = denominator[i] * denominator_scaling;
             }
         }
-
-        // Final step: invert denominator
-        FF::batch_invert(std::span{ &denominator.data()[start], end - start });
     });
 
+    // Final step: invert denominator
+    FF::parallel_batch_invert(denominator.coeffs().subspan(0, active_domain_size - 1));
+
     DEBUG_LOG_ALL(numerator.coeffs());
     DEBUG_LOG_ALL(denominator.coeffs());
 
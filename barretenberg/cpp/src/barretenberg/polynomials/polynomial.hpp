@@ -6,6 +6,7 @@
 #include "barretenberg/crypto/sha256/sha256.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include "barretenberg/plonk_honk_shared/types/circuit_type.hpp"
+#include "barretenberg/polynomials/polynomial_arena.hpp"
 #include "barretenberg/polynomials/shared_shifted_virtual_zeroes_array.hpp"
 #include "evaluation_domain.hpp"
 #include "polynomial_arithmetic.hpp"
@@ -432,6 +433,11 @@ template <typename Fr> class Polynomial {
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
 template <typename Fr> std::shared_ptr<Fr[]> _allocate_aligned_memory(size_t n_elements)
 {
+    // Draw from the arena of the prover running on this thread, if any (see PolynomialArena)
+    if (PolynomialArena* arena = PolynomialArena::current()) {
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+        return std::static_pointer_cast<Fr[]>(arena->allocate(sizeof(Fr) * n_elements));
+    }
     // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
     return std::static_pointer_cast<Fr[]>(get_mem_slab(sizeof(Fr) * n_elements));
 }
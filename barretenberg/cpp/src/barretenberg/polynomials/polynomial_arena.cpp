@@ -0,0 +1,185 @@
+#include "polynomial_arena.hpp"
+#include "barretenberg/common/mem.hpp"
+#include "barretenberg/common/slab_allocator.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/numeric/bitop/get_msb.hpp"
+
+#include <algorithm>
+#include <array>
+#include <vector>
+#ifndef NO_MULTITHREADING
+#include <mutex>
+#endif
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+namespace bb {
+
+namespace {
+constexpr size_t BLOCK_ALIGNMENT = 64;
+constexpr size_t HUGE_PAGE_SIZE = static_cast<size_t>(1) << 21;
+
+void* allocate_block(size_t size, [[maybe_unused]] bool use_huge_pages)
+{
+#ifdef __linux__
+    if (use_huge_pages && size >= HUGE_PAGE_SIZE) {
+        void* ptr = aligned_alloc(HUGE_PAGE_SIZE, size);
+        // Only a hint: without transparent huge page support the block is backed by regular pages
+        ::madvise(ptr, size, MADV_HUGEPAGE);
+        return ptr;
+    }
+#endif
+    return aligned_alloc(BLOCK_ALIGNMENT, size);
+}
+} // namespace
+
+struct PolynomialArena::State {
+    struct SizeClass {
+        std::vector<void*> free_blocks;
+        size_t num_in_use = 0;
+        // Largest value of num_in_use since the last reset
+        size_t peak_in_use = 0;
+    };
+
+    explicit State(Options options)
+        : options(options)
+    {}
+    State(const State&) = delete;
+    State& operator=(const State&) = delete;
+    State(State&&) = delete;
+    State& operator=(State&&) = delete;
+    ~State() { release_free_blocks(); }
+
+    void release_free_blocks()
+    {
+        for (size_t log_size = 0; log_size < size_classes.size(); ++log_size) {
+            for (void* block : size_classes[log_size].free_blocks) {
+                aligned_free(block);
+                stats.bytes_reserved -= static_cast<size_t>(1) << log_size;
+            }
+            size_classes[log_size].free_blocks.clear();
+        }
+    }
+
+    const Options options;
+#ifndef NO_MULTITHREADING
+    std::mutex mutex;
+#endif
+    // Indexed by log2 of the block size
+    std::array<SizeClass, 64> size_classes;
+    Stats stats;
+    // Cleared when the arena is destroyed, after which released blocks are freed rather than pooled
+    bool pooling = true;
+};
+
+PolynomialArena::PolynomialArena()
+    : PolynomialArena(Options{})
+{}
+
+PolynomialArena::PolynomialArena(Options options)
+    : state_(std::make_shared<State>(options))
+{}
+
+PolynomialArena::~PolynomialArena()
+{
+#ifndef NO_MULTITHREADING
+    std::unique_lock<std::mutex> lock(state_->mutex);
+#endif
+    state_->pooling = false;
+    state_->release_free_blocks();
+}
+
+std::shared_ptr<void> PolynomialArena::allocate(size_t size)
+{
+    if (size < state_->options.min_block_size) {
+        return get_mem_slab(size);
+    }
+    const size_t log_size = numeric::get_msb(size - 1) + 1;
+    const size_t block_size = static_cast<size_t>(1) << log_size;
+
+    void* block = nullptr;
+    {
+#ifndef NO_MULTITHREADING
+        std::unique_lock<std::mutex> lock(state_->mutex);
+#endif
+        auto& size_class = state_->size_classes[log_size];
+        if (!size_class.free_blocks.empty()) {
+            block = size_class.free_blocks.back();
+            size_class.free_blocks.pop_back();
+            state_->stats.num_blocks_reused++;
+        } else {
+            state_->stats.num_blocks_allocated++;
+            state_->stats.bytes_reserved += block_size;
+        }
+        size_class.num_in_use++;
+        size_class.peak_in_use = std::max(size_class.peak_in_use, size_class.num_in_use);
+        state_->stats.bytes_in_use += block_size;
+        state_->stats.peak_bytes_in_use = std::max(state_->stats.peak_bytes_in_use, state_->stats.bytes_in_use);
+    }
+    if (block == nullptr) {
+        block = allocate_block(block_size, state_->options.use_huge_pages);
+    }
+
+    return { block, [state = state_, log_size](void* ptr) {
+                const size_t block_size = static_cast<size_t>(1) << log_size;
+#ifndef NO_MULTITHREADING
+                std::unique_lock<std::mutex> lock(state->mutex);
+#endif
+                auto& size_class = state->size_classes[log_size];
+                size_class.num_in_use--;
+                state->stats.bytes_in_use -= block_size;
+                if (state->pooling) {
+                    size_class.free_blocks.push_back(ptr);
+                } else {
+                    aligned_free(ptr);
+                    state->stats.bytes_reserved -= block_size;
+                }
+            } };
+}
+
+void PolynomialArena::reset()
+{
+#ifndef NO_MULTITHREADING
+    std::unique_lock<std::mutex> lock(state_->mutex);
+#endif
+    for (size_t log_size = 0; log_size < state_->size_classes.size(); ++log_size) {
+        auto& size_class = state_->size_classes[log_size];
+        // Keep enough blocks to serve the peak of the last proof without going back to the system allocator
+        const size_t num_to_keep =
+            size_class.peak_in_use > size_class.num_in_use ? size_class.peak_in_use - size_class.num_in_use : 0;
+        while (size_class.free_blocks.size() > num_to_keep) {
+            aligned_free(size_class.free_blocks.back());
+            size_class.free_blocks.pop_back();
+            state_->stats.bytes_reserved -= static_cast<size_t>(1) << log_size;
+        }
+        size_class.peak_in_use = size_class.num_in_use;
+    }
+    state_->stats.peak_bytes_in_use = state_->stats.bytes_in_use;
+}
+
+PolynomialArena::Stats PolynomialArena::get_stats() const
+{
+#ifndef NO_MULTITHREADING
+    std::unique_lock<std::mutex> lock(state_->mutex);
+#endif
+    return state_->stats;
+}
+
+PolynomialArena* PolynomialArena::current()
+{
+    return static_cast<PolynomialArena*>(get_thread_context().polynomial_arena);
+}
+
+PolynomialArena::Scope::Scope(PolynomialArena& arena)
+    : previous_(current())
+{
+    get_thread_context().polynomial_arena = &arena;
+}
+
+PolynomialArena::Scope::~Scope()
+{
+    get_thread_context().polynomial_arena = previous_;
+}
+
+} // namespace bb
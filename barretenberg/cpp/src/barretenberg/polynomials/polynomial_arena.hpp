@@ -0,0 +1,104 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+
+namespace bb {
+
+/**
+ * @brief A pool of polynomial backing memory that is reused from one proof to the next
+ *
+ * @details Allocations of at least `min_block_size` bytes are rounded up to a power of two and served from a free list
+ * per size class. When the last reference to a block is dropped it goes back to its free list instead of to the system
+ * allocator, so a prover that constructs many proofs of similar size stops paying for multi-GB malloc/free cycles and
+ * for page faulting fresh memory after the first proof. Smaller allocations are passed through to get_mem_slab.
+ *
+ * The arena is meant to be owned by a prover (or a proving service) rather than being global, e.g. ClientIVC keeps one
+ * for the circuits it accumulates. Polynomials allocated on a thread while a PolynomialArena::Scope is active draw
+ * their memory from that arena, and so do the ones allocated in a parallel_for started from that thread:
+ *
+ *     PolynomialArena arena;
+ *     for (auto& circuit : circuits) {
+ *         {
+ *             PolynomialArena::Scope scope(arena);
+ *             prove(circuit);
+ *         }
+ *         arena.reset();
+ *     }
+ *
+ * `reset` marks the end of a proof: it returns to the system the free blocks of every size class beyond the number
+ * that were in use at the same time during the proof, so that the arena keeps exactly the working set of the last
+ * proof. Blocks are shared with their polynomials, so the arena may be destroyed while blocks are still in use; those
+ * are then freed when released.
+ *
+ * Memory handed out by the arena is not zeroed. Blocks are 64 byte aligned, or 2 MiB aligned and advised to be backed
+ * by transparent huge pages when `use_huge_pages` is set (Linux only).
+ */
+class PolynomialArena {
+  public:
+    struct Options {
+        // Allocations smaller than this are not pooled
+        size_t min_block_size = static_cast<size_t>(1) << 16;
+        bool use_huge_pages = false;
+    };
+
+    struct Stats {
+        // Blocks obtained from the system allocator, over the lifetime of the arena
+        size_t num_blocks_allocated = 0;
+        // Allocations served by a block released earlier, over the lifetime of the arena
+        size_t num_blocks_reused = 0;
+        // Memory currently held by the arena, in use or free
+        size_t bytes_reserved = 0;
+        // Memory currently handed out
+        size_t bytes_in_use = 0;
+        // Largest value of bytes_in_use since the last reset
+        size_t peak_bytes_in_use = 0;
+    };
+
+    /**
+     * @brief Makes an arena serve the polynomial allocations of the current thread, and of the parallel_for calls it
+     * makes, for the lifetime of the scope
+     */
+    class Scope {
+      public:
+        explicit Scope(PolynomialArena& arena);
+        ~Scope();
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+        Scope(Scope&&) = delete;
+        Scope& operator=(Scope&&) = delete;
+
+      private:
+        PolynomialArena* previous_;
+    };
+
+    PolynomialArena();
+    explicit PolynomialArena(Options options);
+    ~PolynomialArena();
+    PolynomialArena(const PolynomialArena&) = delete;
+    PolynomialArena& operator=(const PolynomialArena&) = delete;
+    PolynomialArena(PolynomialArena&&) = delete;
+    PolynomialArena& operator=(PolynomialArena&&) = delete;
+
+    /**
+     * @brief Allocate at least `size` bytes of uninitialized memory, returned to the arena when released
+     */
+    std::shared_ptr<void> allocate(size_t size);
+
+    /**
+     * @brief Trim the free lists to the working set since the last reset, see class description
+     */
+    void reset();
+
+    Stats get_stats() const;
+
+    /**
+     * @brief The arena of the innermost active Scope on this thread, or nullptr
+     */
+    static PolynomialArena* current();
+
+  private:
+    struct State;
+    std::shared_ptr<State> state_;
+};
+
+} // namespace bb
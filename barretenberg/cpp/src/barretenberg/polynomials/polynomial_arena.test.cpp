@@ -0,0 +1,110 @@
+#include <cstddef>
+#include <gtest/gtest.h>
+
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/polynomials/polynomial.hpp"
+#include "barretenberg/polynomials/polynomial_arena.hpp"
+
+using namespace bb;
+
+namespace {
+using FF = bb::fr;
+constexpr size_t POLY_SIZE = 1 << 12;                      // 128 KiB of coefficients
+constexpr size_t POLY_BLOCK_SIZE = POLY_SIZE * sizeof(FF); // already a power of two
+} // namespace
+
+TEST(PolynomialArena, PolynomialsReuseMemoryAcrossProofs)
+{
+    PolynomialArena arena;
+    const FF* first_data = nullptr;
+    for (size_t proof = 0; proof < 3; ++proof) {
+        {
+            PolynomialArena::Scope scope(arena);
+            Polynomial<FF> a(POLY_SIZE);
+            Polynomial<FF> b = Polynomial<FF>::random(POLY_SIZE - 1, POLY_SIZE, /*start_index*/ 1);
+            // Zeroing constructors still zero recycled memory
+            for (size_t i = 0; i < POLY_SIZE; ++i) {
+                EXPECT_EQ(a[i], FF::zero());
+            }
+            a.at(5) = b[5];
+            if (proof == 0) {
+                first_data = a.data();
+            } else {
+                // The most recently released block of the size class is handed out first
+                EXPECT_TRUE(a.data() == first_data || b.data() == first_data);
+            }
+            EXPECT_EQ(arena.get_stats().bytes_in_use, 2 * POLY_BLOCK_SIZE);
+        }
+        arena.reset();
+    }
+    const auto stats = arena.get_stats();
+    EXPECT_EQ(stats.num_blocks_allocated, 2);
+    EXPECT_EQ(stats.num_blocks_reused, 4);
+    EXPECT_EQ(stats.bytes_reserved, 2 * POLY_BLOCK_SIZE);
+    EXPECT_EQ(stats.bytes_in_use, 0);
+
+    // Outside of a scope polynomials do not use the arena
+    Polynomial<FF> c(POLY_SIZE);
+    EXPECT_EQ(arena.get_stats().num_blocks_reused, 4);
+}
+
+TEST(PolynomialArena, ResetKeepsWorkingSetOfLastProof)
+{
+    PolynomialArena arena;
+    {
+        std::vector<std::shared_ptr<void>> blocks;
+        for (size_t i = 0; i < 4; ++i) {
+            blocks.push_back(arena.allocate(POLY_BLOCK_SIZE));
+        }
+    }
+    arena.reset();
+    EXPECT_EQ(arena.get_stats().bytes_reserved, 4 * POLY_BLOCK_SIZE);
+
+    // A smaller proof only needs one block at a time, so the other three are released on reset
+    for (size_t i = 0; i < 3; ++i) {
+        auto block = arena.allocate(POLY_BLOCK_SIZE - 100);
+    }
+    arena.reset();
+    EXPECT_EQ(arena.get_stats().bytes_reserved, POLY_BLOCK_SIZE);
+    EXPECT_EQ(arena.get_stats().peak_bytes_in_use, 0);
+
+    // Small allocations bypass the arena
+    auto small = arena.allocate(100);
+    EXPECT_EQ(arena.get_stats().bytes_in_use, 0);
+}
+
+TEST(PolynomialArena, BlocksOutliveArena)
+{
+    Polynomial<FF> poly;
+    {
+        PolynomialArena arena(PolynomialArena::Options{ .min_block_size = 1024, .use_huge_pages = true });
+        PolynomialArena::Scope scope(arena);
+        poly = Polynomial<FF>::random(POLY_SIZE);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(poly.data()) % 64, 0);
+    }
+    // The block is freed, not pooled, when the polynomial goes away after the arena
+    FF sum = 0;
+    for (size_t i = 0; i < POLY_SIZE; ++i) {
+        sum += poly[i];
+    }
+    EXPECT_NE(sum, FF::zero());
+}
+
+TEST(PolynomialArena, ParallelForWorkersUseArenaOfCaller)
+{
+    constexpr size_t NUM_POLYS = 8;
+    // Make sure the iterations run on other threads than this one
+    set_parallel_for_concurrency(4);
+    PolynomialArena arena;
+    std::vector<Polynomial<FF>> polys(NUM_POLYS);
+    {
+        PolynomialArena::Scope scope(arena);
+        parallel_for(NUM_POLYS, [&](size_t i) { polys[i] = Polynomial<FF>(POLY_SIZE); });
+    }
+    EXPECT_EQ(arena.get_stats().bytes_in_use, NUM_POLYS * POLY_BLOCK_SIZE);
+
+    // The workers are back to no arena once the parallel_for is done
+    parallel_for(NUM_POLYS, [&](size_t i) { polys[i] = Polynomial<FF>(POLY_SIZE); });
+    EXPECT_EQ(arena.get_stats().bytes_in_use, 0);
+    set_parallel_for_concurrency(0);
+}
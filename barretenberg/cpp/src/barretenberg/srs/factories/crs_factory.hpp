@@ -23,7 +23,7 @@ template <typename Curve> class ProverCrs {
     /**
      *  @brief Returns the monomial points in a form to be consumed by scalar_multiplication pippenger algorithm.
      */
-    virtual std::span<typename Curve::AffineElement> get_monomial_points() = 0;
+    virtual std::span<const typename Curve::AffineElement> get_monomial_points() = 0;
     virtual size_t get_monomial_size() const = 0;
 };
 
@@ -8,8 +8,107 @@
 #include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 
+#include <functional>
+#include <future>
+#include <map>
+#include <mutex>
+
 namespace bb::srs::factories {
 
+namespace {
+/**
+ * @brief Process-wide registry of the CRS objects loaded from each CRS directory
+ *
+ * @details Entries are keyed by (path, size), and a lookup is served by the smallest registered CRS of at least the
+ * requested size, so that every factory on the same directory shares one CRS instead of reading and building its own.
+ * Registering a CRS replaces the smaller entries for the same path. The registry only holds weak references: a CRS is
+ * freed with its last user, i.e. the last factory or proving key holding it.
+ */
+template <typename Crs> class CrsRegistry {
+  public:
+    /**
+     * @brief Return a registered CRS of at least `degree` points, or register the one built by `create`
+     * @details The registry is not locked while `create` runs: requests for other paths or sizes proceed, and
+     * concurrent requests served by the CRS being built wait for it instead of building it again. `create` receives
+     * the largest live CRS for the same path with fewer than `degree` points (or nullptr), to grow from. If `create`
+     * throws, the exception is rethrown to the waiting requests too, and the next request builds the CRS again.
+     */
+    std::shared_ptr<Crs> get_or_create(const std::string& path,
+                                       size_t degree,
+                                       const std::function<std::shared_ptr<Crs>(const std::shared_ptr<Crs>&)>& create)
+    {
+        std::promise<std::shared_ptr<Crs>> promise;
+        std::shared_ptr<Crs> smaller;
+        const Key key{ path, degree };
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            auto it = entries_.lower_bound(key);
+            while (it != entries_.end() && it->first.first == path) {
+                if (it->second.pending.valid()) {
+                    auto pending = it->second.pending;
+                    lock.unlock();
+                    return pending.get();
+                }
+                if (auto crs = it->second.crs.lock()) {
+                    return crs;
+                }
+                it = entries_.erase(it);
+            }
+            for (auto smaller_it = entries_.lower_bound({ path, 0 });
+                 smaller_it != entries_.end() && smaller_it->first < key;
+                 ++smaller_it) {
+                if (auto crs = smaller_it->second.crs.lock()) {
+                    smaller = std::move(crs);
+                }
+            }
+            entries_[key] = Entry{ .pending = promise.get_future().share(), .crs = {} };
+        }
+
+        std::shared_ptr<Crs> crs;
+        try {
+            crs = create(smaller);
+        } catch (...) {
+            promise.set_exception(std::current_exception());
+            std::lock_guard<std::mutex> lock(mutex_);
+            entries_.erase(key);
+            throw;
+        }
+        promise.set_value(crs);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        entries_[key] = Entry{ .pending = {}, .crs = crs };
+        // The smaller CRSes that are not being built are superseded by this one
+        for (auto smaller_it = entries_.lower_bound({ path, 0 }); smaller_it->first < key;) {
+            smaller_it = smaller_it->second.pending.valid() ? std::next(smaller_it) : entries_.erase(smaller_it);
+        }
+        return crs;
+    }
+
+  private:
+    using Key = std::pair<std::string, size_t>;
+    struct Entry {
+        // Set while the CRS is being built
+        std::shared_future<std::shared_ptr<Crs>> pending;
+        std::weak_ptr<Crs> crs;
+    };
+    std::mutex mutex_;
+    std::map<Key, Entry> entries_;
+};
+
+// Both registries only hold weak references: a factory keeps its CRS alive, and a CRS no factory holds is freed
+template <typename Curve> CrsRegistry<FileProverCrs<Curve>>& get_prover_crs_registry()
+{
+    static CrsRegistry<FileProverCrs<Curve>> registry;
+    return registry;
+}
+
+template <typename Curve> CrsRegistry<VerifierCrs<Curve>>& get_verifier_crs_registry()
+{
+    static CrsRegistry<VerifierCrs<Curve>> registry;
+    return registry;
+}
+} // namespace
+
 FileVerifierCrs<curve::BN254>::FileVerifierCrs(std::string const& path, const size_t)
     : precomputed_g2_lines((bb::pairing::miller_lines*)(aligned_alloc(64, sizeof(bb::pairing::miller_lines) * 2)))
 {
@@ -31,9 +130,15 @@ FileVerifierCrs<curve::Grumpkin>::FileVerifierCrs(std::string const& path, const
     : num_points(num_points)
 {
     using Curve = curve::Grumpkin;
-    monomials_ = scalar_multiplication::point_table_alloc<Curve::AffineElement>(num_points);
-    srs::IO<Curve>::read_transcript_g1(monomials_.get(), num_points, path);
-    scalar_multiplication::generate_pippenger_point_table<Curve>(monomials_.get(), monomials_.get(), num_points);
+    const auto cache_path = PointTableCache<Curve>::get_path(path);
+    monomials_ = PointTableCache<Curve>::load(cache_path, num_points, read_transcript_digest<Curve>(path));
+    if (!monomials_) {
+        auto point_table = scalar_multiplication::point_table_alloc<Curve::AffineElement>(num_points);
+        srs::IO<Curve>::read_transcript_g1(point_table.get(), num_points, path);
+        scalar_multiplication::generate_pippenger_point_table<Curve>(point_table.get(), point_table.get(), num_points);
+        monomials_ = std::move(point_table);
+        PointTableCache<Curve>::store(cache_path, get_monomial_points());
+    }
     g1_identity = monomials_[0];
 };
 
@@ -60,9 +165,35 @@ std::shared_ptr<bb::srs::factories::ProverCrs<Curve>> FileCrsFactory<Curve>::get
     PROFILE_THIS();
 
     if (prover_degree_ < degree || !prover_crs_) {
-        prover_crs_ = std::make_shared<FileProverCrs<Curve>>(degree, path_);
-        prover_degree_ = degree;
-        vinfo("Initialized ", Curve::name, " prover CRS from file of size ", degree);
+        bool constructed = false;
+        prover_crs_ = get_prover_crs_registry<Curve>().get_or_create(
+            path_, degree, [&](const std::shared_ptr<FileProverCrs<Curve>>& smaller_crs) {
+                // Grow the largest existing CRS rather than reloading it from scratch
+                constructed = true;
+                return std::make_shared<FileProverCrs<Curve>>(degree, path_, smaller_crs.get());
+            });
+        prover_degree_ = prover_crs_->get_monomial_size();
+        prover_crs_metrics_.num_materialized_points = prover_degree_;
+        if (!constructed) {
+            vinfo("Sharing ", Curve::name, " prover CRS of size ", prover_degree_, " for requested size ", degree);
+            return prover_crs_;
+        }
+
+        prover_crs_metrics_.num_points_read += prover_crs_->num_points_read;
+        prover_crs_metrics_.num_points_reused += prover_crs_->num_points_reused;
+        prover_crs_metrics_.num_points_mapped += prover_crs_->num_points_mapped;
+        prover_crs_metrics_.num_loads++;
+        vinfo("Initialized ",
+              Curve::name,
+              " prover CRS of size ",
+              degree,
+              " (read ",
+              prover_crs_->num_points_read,
+              " points from file, reused ",
+              prover_crs_->num_points_reused,
+              ", mapped ",
+              prover_crs_->num_points_mapped,
+              ")");
     }
     return prover_crs_;
 }
@@ -71,9 +202,12 @@ template <typename Curve>
 std::shared_ptr<bb::srs::factories::VerifierCrs<Curve>> FileCrsFactory<Curve>::get_verifier_crs(size_t degree)
 {
     if (verifier_degree_ < degree || !verifier_crs_) {
-        verifier_crs_ = std::make_shared<FileVerifierCrs<Curve>>(path_, degree);
+        verifier_crs_ = get_verifier_crs_registry<Curve>().get_or_create(
+            path_, degree, [&](const std::shared_ptr<VerifierCrs<Curve>>&) {
+                vinfo("Initialized ", Curve::name, " verifier CRS from file of size ", degree);
+                return std::make_shared<FileVerifierCrs<Curve>>(path_, degree);
+            });
         verifier_degree_ = degree;
-        vinfo("Initialized ", Curve::name, " verifier CRS from file of size ", degree);
     }
     return verifier_crs_;
 }
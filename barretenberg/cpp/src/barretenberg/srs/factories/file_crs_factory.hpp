@@ -1,17 +1,51 @@
 #pragma once
 #include "../io.hpp"
+#include "../point_table_cache.hpp"
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "crs_factory.hpp"
+#include <algorithm>
+#include <array>
 #include <cstddef>
 #include <utility>
 
 namespace bb::srs::factories {
 
+template <typename Curve> class FileProverCrs;
+
+/**
+ * @brief The PointTableCache digest of the transcripts in a CRS directory, read from their first points
+ */
+template <typename Curve> uint64_t read_transcript_digest(std::string const& path)
+{
+    std::array<typename Curve::AffineElement, PointTableCache<Curve>::DIGEST_NUM_POINTS> points;
+    srs::IO<Curve>::read_transcript_g1(points.data(), points.size(), path);
+    return PointTableCache<Curve>::compute_digest(points);
+}
+
+/**
+ * @brief Counters describing how the prover CRS of a FileCrsFactory has been materialized
+ */
+struct ProverCrsMetrics {
+    // Size of the current prover CRS
+    size_t num_materialized_points = 0;
+    // Points read from transcript files and turned into point table entries, over all loads
+    size_t num_points_read = 0;
+    // Points copied over from the previous, smaller prover CRS when growing it, over all loads
+    size_t num_points_reused = 0;
+    // Points mapped from a point table cache file, over all loads
+    size_t num_points_mapped = 0;
+    // Number of times a prover CRS was constructed
+    size_t num_loads = 0;
+};
+
 /**
  * Create reference strings given a path to a directory of transcript files.
+ *
+ * CRS objects are shared process-wide: all factories on the same directory are served the same prover and verifier CRS
+ * while it is in use, and a CRS requested while another factory builds it is only built once.
  */
 template <typename Curve> class FileCrsFactory : public CrsFactory<Curve> {
   public:
@@ -22,12 +56,15 @@ template <typename Curve> class FileCrsFactory : public CrsFactory<Curve> {
 
     std::shared_ptr<bb::srs::factories::VerifierCrs<Curve>> get_verifier_crs(size_t degree = 0) override;
 
+    const ProverCrsMetrics& get_prover_crs_metrics() const { return prover_crs_metrics_; }
+
   private:
     std::string path_;
     size_t prover_degree_;
     size_t verifier_degree_;
-    std::shared_ptr<bb::srs::factories::ProverCrs<Curve>> prover_crs_;
+    std::shared_ptr<FileProverCrs<Curve>> prover_crs_;
     std::shared_ptr<bb::srs::factories::VerifierCrs<Curve>> verifier_crs_;
+    ProverCrsMetrics prover_crs_metrics_;
 };
 
 template <typename Curve> class FileProverCrs : public ProverCrs<Curve> {
@@ -37,20 +74,43 @@ template <typename Curve> class FileProverCrs : public ProverCrs<Curve> {
      * @details Allocates space in monomials_ for 2 * num_points affine elements, populates the first num_points with
      * the raw SRS elements P_i, then overwrites the same memory with the 'pippenger point table' which contains the raw
      * elements P_i at even indices and the endomorphism point (\beta * P_i.x, -P_i.y) at odd indices.
+     * If the directory contains a point table cache of its transcripts with enough points, the table is mapped from it
+     * instead (see PointTableCache). Otherwise the table is computed and written to the cache for the next process.
+     *
+     * When growing an existing CRS, pass it as `prefix`: its point table entries are copied over, and only the points
+     * beyond it are read from the transcripts and have their endomorphism points computed. The prefix is left
+     * untouched, so MSMs still running against it are unaffected.
      *
      * @param num_points
      * @param path
+     * @param prefix A smaller CRS loaded from the same path, or nullptr
      */
-    FileProverCrs(const size_t num_points, std::string const& path)
+    FileProverCrs(const size_t num_points, std::string const& path, const FileProverCrs* prefix = nullptr)
         : num_points(num_points)
     {
 
         PROFILE_THIS_NAME("FileProverCrs constructor");
 
-        monomials_ = scalar_multiplication::point_table_alloc<typename Curve::AffineElement>(num_points);
-
-        srs::IO<Curve>::read_transcript_g1(monomials_.get(), num_points, path);
-        scalar_multiplication::generate_pippenger_point_table<Curve>(monomials_.get(), monomials_.get(), num_points);
+        const auto cache_path = PointTableCache<Curve>::get_path(path);
+        monomials_ = PointTableCache<Curve>::load(cache_path, num_points, read_transcript_digest<Curve>(path));
+        if (monomials_) {
+            num_points_mapped = num_points;
+            return;
+        }
+
+        auto point_table = scalar_multiplication::point_table_alloc<typename Curve::AffineElement>(num_points);
+
+        if (prefix != nullptr) {
+            num_points_reused = std::min(prefix->num_points, num_points);
+            std::copy_n(prefix->monomials_.get(), 2 * num_points_reused, point_table.get());
+        }
+        num_points_read = num_points - num_points_reused;
+
+        typename Curve::AffineElement* tail = point_table.get() + 2 * num_points_reused;
+        srs::IO<Curve>::read_transcript_g1(tail, num_points, path, num_points_reused);
+        scalar_multiplication::generate_pippenger_point_table<Curve>(tail, tail, num_points_read);
+        monomials_ = std::move(point_table);
+        PointTableCache<Curve>::store(cache_path, get_monomial_points());
     };
 
     ~FileProverCrs()
@@ -60,13 +120,21 @@ template <typename Curve> class FileProverCrs : public ProverCrs<Curve> {
 #endif
     }
 
-    std::span<typename Curve::AffineElement> get_monomial_points() { return { monomials_.get(), num_points * 2 }; }
+    std::span<const typename Curve::AffineElement> get_monomial_points() override
+    {
+        return { monomials_.get(), num_points * 2 };
+    }
 
     [[nodiscard]] size_t get_monomial_size() const { return num_points; }
 
+    // How the points of this CRS were obtained, see ProverCrsMetrics
+    size_t num_points_read = 0;
+    size_t num_points_reused = 0;
+    size_t num_points_mapped = 0;
+
   private:
     size_t num_points;
-    std::shared_ptr<typename Curve::AffineElement[]> monomials_;
+    std::shared_ptr<const typename Curve::AffineElement[]> monomials_;
 };
 
 template <typename Curve> class FileVerifierCrs : public VerifierCrs<Curve> {
@@ -103,7 +171,7 @@ template <> class FileVerifierCrs<curve::Grumpkin> : public VerifierCrs<curve::G
   private:
     Curve::AffineElement g1_identity;
     size_t num_points;
-    std::shared_ptr<Curve::AffineElement[]> monomials_;
+    std::shared_ptr<const Curve::AffineElement[]> monomials_;
 };
 
 } // namespace bb::srs::factories
@@ -0,0 +1,181 @@
+#include "file_crs_factory.hpp"
+#include "../io.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+using namespace bb;
+using namespace bb::srs::factories;
+using Curve = curve::Grumpkin;
+
+namespace {
+auto& engine = numeric::get_debug_randomness();
+
+/**
+ * @brief A CRS directory with random points split over two transcript files
+ */
+class FileCrsFactoryTest : public ::testing::Test {
+  protected:
+    static constexpr size_t POINTS_PER_TRANSCRIPT = 200;
+    static constexpr size_t NUM_TRANSCRIPTS = 2;
+
+    void SetUp() override
+    {
+        dir = std::filesystem::temp_directory_path() / ("bb_file_crs_factory_test_" + std::to_string(::getpid()));
+        std::filesystem::create_directories(dir / "monomial");
+        write_transcripts();
+    }
+    void TearDown() override { std::filesystem::remove_all(dir); }
+
+    // (Re)generate the points and write them to the transcript files
+    void write_transcripts()
+    {
+        points.resize(POINTS_PER_TRANSCRIPT * NUM_TRANSCRIPTS);
+        for (auto& point : points) {
+            point = Curve::AffineElement::random_element(&engine);
+        }
+        for (size_t i = 0; i < NUM_TRANSCRIPTS; ++i) {
+            srs::Manifest manifest{ .transcript_number = static_cast<uint32_t>(i),
+                                    .total_transcripts = NUM_TRANSCRIPTS,
+                                    .total_g1_points = static_cast<uint32_t>(points.size()),
+                                    .total_g2_points = 0,
+                                    .num_g1_points = POINTS_PER_TRANSCRIPT,
+                                    .num_g2_points = 0,
+                                    .start_from = static_cast<uint32_t>(i * POINTS_PER_TRANSCRIPT) };
+            srs::IO<Curve>::write_transcript(&points[i * POINTS_PER_TRANSCRIPT], manifest, dir.string());
+        }
+    }
+
+    void check_point_table(ProverCrs<Curve>& crs, size_t num_points)
+    {
+        ASSERT_EQ(crs.get_monomial_size(), num_points);
+        std::vector<Curve::AffineElement> expected(2 * num_points);
+        scalar_multiplication::generate_pippenger_point_table<Curve>(points.data(), expected.data(), num_points);
+        auto table = crs.get_monomial_points();
+        for (size_t i = 0; i < 2 * num_points; ++i) {
+            EXPECT_EQ(table[i], expected[i]);
+        }
+    }
+
+    std::filesystem::path dir;
+    std::vector<Curve::AffineElement> points;
+};
+} // namespace
+
+TEST_F(FileCrsFactoryTest, ProverCrsGrowsIncrementally)
+{
+    {
+        FileCrsFactory<Curve> factory(dir.string());
+
+        auto small_crs = factory.get_prover_crs(150);
+        check_point_table(*small_crs, 150);
+        EXPECT_EQ(factory.get_prover_crs_metrics().num_points_read, 150);
+
+        // A smaller request is served by the existing CRS
+        EXPECT_EQ(factory.get_prover_crs(100), small_crs);
+
+        // Growing across the transcript boundary only reads the new points
+        auto large_crs = factory.get_prover_crs(350);
+        check_point_table(*large_crs, 350);
+        const auto& metrics = factory.get_prover_crs_metrics();
+        EXPECT_EQ(metrics.num_materialized_points, 350);
+        EXPECT_EQ(metrics.num_points_read, 350);
+        EXPECT_EQ(metrics.num_points_reused, 150);
+        EXPECT_EQ(metrics.num_loads, 2);
+
+        // The smaller CRS is still valid
+        check_point_table(*small_crs, 150);
+    }
+
+    // Once all users of the CRS are gone, a new factory on the same directory maps the point table cache written by
+    // the last load
+    FileCrsFactory<Curve> other_factory(dir.string());
+    auto mapped_crs = other_factory.get_prover_crs(300);
+    check_point_table(*mapped_crs, 300);
+    EXPECT_EQ(other_factory.get_prover_crs_metrics().num_points_read, 0);
+    EXPECT_EQ(other_factory.get_prover_crs_metrics().num_points_mapped, 300);
+}
+
+TEST_F(FileCrsFactoryTest, IgnoresCacheOfOtherTranscripts)
+{
+    {
+        FileCrsFactory<Curve> factory(dir.string());
+        check_point_table(*factory.get_prover_crs(100), 100);
+    }
+    // The cache written for the old transcripts must not be mapped for the new ones
+    write_transcripts();
+    FileCrsFactory<Curve> factory(dir.string());
+    check_point_table(*factory.get_prover_crs(100), 100);
+    EXPECT_EQ(factory.get_prover_crs_metrics().num_points_mapped, 0);
+    EXPECT_EQ(factory.get_prover_crs_metrics().num_points_read, 100);
+}
+
+TEST_F(FileCrsFactoryTest, CrsIsSharedAcrossFactories)
+{
+    FileCrsFactory<Curve> factory(dir.string());
+    FileCrsFactory<Curve> other_factory(dir.string());
+
+    // A live prover CRS serves requests of at most its size from any factory on the same directory
+    auto prover_crs = factory.get_prover_crs(250);
+    EXPECT_EQ(other_factory.get_prover_crs(200), prover_crs);
+    EXPECT_EQ(other_factory.get_prover_crs_metrics().num_loads, 0);
+    EXPECT_EQ(other_factory.get_prover_crs_metrics().num_materialized_points, 250);
+
+    // A larger request grows it once, and the result is shared again
+    auto large_crs = other_factory.get_prover_crs(400);
+    check_point_table(*large_crs, 400);
+    EXPECT_EQ(other_factory.get_prover_crs_metrics().num_points_reused, 250);
+    EXPECT_EQ(factory.get_prover_crs(400), large_crs);
+    EXPECT_EQ(factory.get_prover_crs_metrics().num_loads, 1);
+
+    // The verifier CRS is built once per directory and size
+    auto verifier_crs = factory.get_verifier_crs(300);
+    EXPECT_EQ(other_factory.get_verifier_crs(300), verifier_crs);
+    EXPECT_EQ(verifier_crs->get_monomial_size(), 300);
+    auto verifier_points = verifier_crs->get_monomial_points();
+    for (size_t i = 0; i < 600; ++i) {
+        EXPECT_EQ(verifier_points[i], large_crs->get_monomial_points()[i]);
+    }
+}
+
+TEST_F(FileCrsFactoryTest, ConcurrentRequestsBuildCrsOnce)
+{
+    constexpr size_t NUM_THREADS = 4;
+    std::vector<FileCrsFactory<Curve>> factories;
+    for (size_t i = 0; i < NUM_THREADS; ++i) {
+        factories.emplace_back(dir.string());
+    }
+    std::vector<std::shared_ptr<ProverCrs<Curve>>> crses(NUM_THREADS);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < NUM_THREADS; ++i) {
+        threads.emplace_back([&, i] { crses[i] = factories[i].get_prover_crs(300); });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    size_t num_loads = 0;
+    for (size_t i = 0; i < NUM_THREADS; ++i) {
+        EXPECT_EQ(crses[i], crses[0]);
+        num_loads += factories[i].get_prover_crs_metrics().num_loads;
+    }
+    EXPECT_EQ(num_loads, 1);
+    check_point_table(*crses[0], 300);
+}
+
+TEST_F(FileCrsFactoryTest, VerifierCrsIsFreedWithItsLastUser)
+{
+    std::weak_ptr<VerifierCrs<Curve>> verifier_crs;
+    {
+        FileCrsFactory<Curve> factory(dir.string());
+        verifier_crs = factory.get_verifier_crs(300);
+        EXPECT_EQ(FileCrsFactory<Curve>(dir.string()).get_verifier_crs(300), verifier_crs.lock());
+    }
+    EXPECT_TRUE(verifier_crs.expired());
+}
@@ -14,27 +14,23 @@ using namespace bb::srs::factories;
 
 using Curve = curve::Grumpkin;
 
+// The verifier uses the same point table as the prover, so it just shares the prover CRS
 class MemVerifierCrs : public VerifierCrs<Grumpkin> {
   public:
-    MemVerifierCrs(std::vector<Grumpkin::AffineElement> const& points)
-        : num_points(points.size())
-        , monomials_(scalar_multiplication::point_table_alloc<Grumpkin::AffineElement>(points.size()))
-    {
-        std::copy(points.begin(), points.end(), monomials_.get());
-        scalar_multiplication::generate_pippenger_point_table<Grumpkin>(monomials_.get(), monomials_.get(), num_points);
-    }
+    MemVerifierCrs(std::shared_ptr<ProverCrs<Grumpkin>> prover_crs)
+        : prover_crs_(std::move(prover_crs))
+    {}
 
     virtual ~MemVerifierCrs() = default;
     std::span<const Grumpkin::AffineElement> get_monomial_points() const override
     {
-        return { monomials_.get(), num_points * 2 };
+        return prover_crs_->get_monomial_points();
     }
-    size_t get_monomial_size() const override { return num_points; }
-    Grumpkin::AffineElement get_g1_identity() const override { return monomials_[0]; };
+    size_t get_monomial_size() const override { return prover_crs_->get_monomial_size(); }
+    Grumpkin::AffineElement get_g1_identity() const override { return prover_crs_->get_monomial_points()[0]; };
 
   private:
-    size_t num_points;
-    std::shared_ptr<Grumpkin::AffineElement[]> monomials_;
+    std::shared_ptr<ProverCrs<Grumpkin>> prover_crs_;
 };
 
 } // namespace
@@ -42,8 +38,12 @@ class MemVerifierCrs : public VerifierCrs<Grumpkin> {
 namespace bb::srs::factories {
 
 MemGrumpkinCrsFactory::MemGrumpkinCrsFactory(std::vector<Grumpkin::AffineElement> const& points)
-    : prover_crs_(std::make_shared<MemProverCrs<Grumpkin>>(points))
-    , verifier_crs_(std::make_shared<MemVerifierCrs>(points))
+    : MemGrumpkinCrsFactory(std::make_shared<MemProverCrs<Grumpkin>>(points))
+{}
+
+MemGrumpkinCrsFactory::MemGrumpkinCrsFactory(std::shared_ptr<bb::srs::factories::ProverCrs<Grumpkin>> prover_crs)
+    : prover_crs_(std::move(prover_crs))
+    , verifier_crs_(std::make_shared<MemVerifierCrs>(prover_crs_))
 {
     vinfo("Initialized ",
           curve::Grumpkin::name,
@@ -10,13 +10,23 @@ template <typename Curve> class MemProverCrs : public ProverCrs<Curve> {
   public:
     MemProverCrs(std::vector<typename Curve::AffineElement> const& points)
         : num_points(points.size())
-        , monomials_(scalar_multiplication::point_table_alloc<typename Curve::AffineElement>(points.size()))
     {
-        std::copy(points.begin(), points.end(), monomials_.get());
-        scalar_multiplication::generate_pippenger_point_table<Curve>(monomials_.get(), monomials_.get(), num_points);
+        auto point_table = scalar_multiplication::point_table_alloc<typename Curve::AffineElement>(num_points);
+        std::copy(points.begin(), points.end(), point_table.get());
+        scalar_multiplication::generate_pippenger_point_table<Curve>(point_table.get(), point_table.get(), num_points);
+        monomials_ = std::move(point_table);
     }
 
-    std::span<typename Curve::AffineElement> get_monomial_points() override
+    /**
+     * @brief Construct from an already computed pippenger point table of 2 * num_points elements, e.g. a mapped
+     * PointTableCache
+     */
+    MemProverCrs(std::shared_ptr<const typename Curve::AffineElement[]> point_table, size_t num_points)
+        : num_points(num_points)
+        , monomials_(std::move(point_table))
+    {}
+
+    std::span<const typename Curve::AffineElement> get_monomial_points() override
     {
         return { monomials_.get(), num_points * 2 };
     }
@@ -25,7 +35,7 @@ template <typename Curve> class MemProverCrs : public ProverCrs<Curve> {
 
   private:
     size_t num_points;
-    std::shared_ptr<typename Curve::AffineElement[]> monomials_;
+    std::shared_ptr<const typename Curve::AffineElement[]> monomials_;
 };
 
 } // namespace bb::srs::factories
\ No newline at end of file
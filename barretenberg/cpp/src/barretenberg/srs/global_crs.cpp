@@ -18,6 +18,12 @@ void init_crs_factory(std::vector<g1::affine_element> const& points, g2::affine_
     crs_factory = std::make_shared<factories::MemBn254CrsFactory>(points, g2_point);
 }
 
+// Initializes the crs using an existing prover crs
+void init_crs_factory(std::shared_ptr<factories::ProverCrs<curve::BN254>> prover_crs, g2::affine_element const g2_point)
+{
+    crs_factory = std::make_shared<factories::MemBn254CrsFactory>(std::move(prover_crs), g2_point);
+}
+
 // Initializes crs from a file path this we use in the entire codebase
 void init_crs_factory(std::string crs_path)
 {
@@ -33,6 +39,12 @@ void init_grumpkin_crs_factory(std::vector<curve::Grumpkin::AffineElement> const
     grumpkin_crs_factory = std::make_shared<factories::MemGrumpkinCrsFactory>(points);
 }
 
+// Initializes the crs using an existing prover crs
+void init_grumpkin_crs_factory(std::shared_ptr<factories::ProverCrs<curve::Grumpkin>> prover_crs)
+{
+    grumpkin_crs_factory = std::make_shared<factories::MemGrumpkinCrsFactory>(std::move(prover_crs));
+}
+
 void init_grumpkin_crs_factory(std::string crs_path)
 {
     if (grumpkin_crs_factory != nullptr) {
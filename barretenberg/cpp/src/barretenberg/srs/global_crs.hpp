@@ -27,6 +27,11 @@ void init_grumpkin_crs_factory(std::string crs_path);
 void init_grumpkin_crs_factory(std::vector<curve::Grumpkin::AffineElement> const& points);
 void init_crs_factory(std::vector<bb::g1::affine_element> const& points, bb::g2::affine_element const g2_point);
 
+// Initializes the crs using an existing prover crs (e.g. one backed by a mapped point table cache)
+void init_grumpkin_crs_factory(std::shared_ptr<factories::ProverCrs<curve::Grumpkin>> prover_crs);
+void init_crs_factory(std::shared_ptr<factories::ProverCrs<curve::BN254>> prover_crs,
+                      bb::g2::affine_element const g2_point);
+
 std::shared_ptr<factories::CrsFactory<curve::BN254>> get_bn254_crs_factory();
 std::shared_ptr<factories::CrsFactory<curve::Grumpkin>> get_grumpkin_crs_factory();
 
@@ -281,7 +281,15 @@ template <typename Curve> class IO {
         byteswap<>(elements, buffer_size);
     }
 
-    static void read_transcript_g1(AffineElement* monomials, size_t degree, std::string const& dir)
+    /**
+     * @brief Read the G1 points with indices [start_index, degree) into monomials[0, degree - start_index)
+     * @details A non-zero start_index is used to extend an already loaded CRS: transcript files that only contain
+     * points below start_index are skipped after reading their manifest.
+     */
+    static void read_transcript_g1(AffineElement* monomials,
+                                   size_t degree,
+                                   std::string const& dir,
+                                   size_t start_index = 0)
     {
         size_t num = 0;
         size_t num_read = 0;
@@ -295,19 +303,23 @@ template <typename Curve> class IO {
             Manifest manifest;
             read_manifest(path, manifest);
 
-            auto offset = sizeof(Manifest);
-            const size_t num_to_read = std::min((size_t)manifest.num_g1_points, degree - num_read);
-            const size_t g1_buffer_size = sizeof(Fq) * 2 * num_to_read;
+            const size_t file_end = std::min(num_read + (size_t)manifest.num_g1_points, degree);
+            if (file_end > start_index) {
+                const size_t first = std::max(num_read, start_index);
+                auto offset = sizeof(Manifest) + sizeof(Fq) * 2 * (first - num_read);
+                const size_t num_to_read = file_end - first;
+                const size_t g1_buffer_size = sizeof(Fq) * 2 * num_to_read;
 
-            char* buffer = (char*)&monomials[num_read];
-            size_t size = 0;
+                char* buffer = (char*)&monomials[first - start_index];
+                size_t size = 0;
 
-            // We must pass the size actually read to the second call, not the desired
-            // g1_buffer_size as the file may have been smaller than this.
-            read_file_into_buffer(buffer, size, path, offset, g1_buffer_size);
-            srs::IO<Curve>::byteswap(&monomials[num_read], size);
+                // We must pass the size actually read to the second call, not the desired
+                // g1_buffer_size as the file may have been smaller than this.
+                read_file_into_buffer(buffer, size, path, offset, g1_buffer_size);
+                srs::IO<Curve>::byteswap(&monomials[first - start_index], size);
+            }
 
-            num_read += num_to_read;
+            num_read = file_end;
             path = get_transcript_path(dir, ++num);
         }
 
@@ -0,0 +1,178 @@
+#include "point_table_cache.hpp"
+#include "barretenberg/common/log.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <system_error>
+
+#ifndef __wasm__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace bb::srs {
+
+namespace {
+template <typename Curve> PointTableCacheHeader make_header(size_t num_points, uint64_t transcript_digest)
+{
+    return PointTableCacheHeader{ .magic = PointTableCacheHeader::MAGIC,
+                                  .version = PointTableCacheHeader::VERSION,
+                                  .curve_tag = Curve::BaseField::modulus.data[0],
+                                  .element_size = sizeof(typename Curve::AffineElement),
+                                  .num_points = num_points,
+                                  .transcript_digest = transcript_digest,
+                                  .reserved = { 0, 0 } };
+}
+
+#ifndef __wasm__
+/**
+ * @brief Read the header of an open cache file and check it against the curve, the transcript and the file size
+ */
+template <typename Curve>
+std::optional<PointTableCacheHeader> read_valid_header(const int fd, uint64_t transcript_digest, size_t& file_size)
+{
+    PointTableCacheHeader header{};
+    struct stat file_stat {};
+    if (::fstat(fd, &file_stat) != 0 ||
+        ::pread(fd, &header, sizeof(header), 0) != static_cast<ssize_t>(sizeof(header))) {
+        return std::nullopt;
+    }
+    constexpr size_t element_size = sizeof(typename Curve::AffineElement);
+    const PointTableCacheHeader expected = make_header<Curve>(header.num_points, transcript_digest);
+    file_size = static_cast<size_t>(file_stat.st_size);
+    if (header.magic != expected.magic || header.version != expected.version ||
+        header.curve_tag != expected.curve_tag || header.element_size != expected.element_size ||
+        header.transcript_digest != expected.transcript_digest ||
+        header.num_points > file_size / (2 * element_size) ||
+        file_size != sizeof(header) + 2 * header.num_points * element_size) {
+        return std::nullopt;
+    }
+    return header;
+}
+#endif
+} // namespace
+
+template <typename Curve> uint64_t PointTableCache<Curve>::compute_digest(std::span<const AffineElement> srs_points)
+{
+    // FNV-1a over the limbs of the (Montgomery form) coordinates
+    uint64_t digest = 0xcbf29ce484222325ULL;
+    for (const auto& point : srs_points.first(std::min(srs_points.size(), DIGEST_NUM_POINTS))) {
+        for (const auto* coordinate : { &point.x, &point.y }) {
+            for (const uint64_t limb : coordinate->data) {
+                digest = (digest ^ limb) * 0x100000001b3ULL;
+            }
+        }
+    }
+    return digest;
+}
+
+template <typename Curve>
+std::filesystem::path PointTableCache<Curve>::get_path(const std::filesystem::path& crs_dir)
+{
+    std::string curve_name = Curve::name;
+    std::transform(curve_name.begin(), curve_name.end(), curve_name.begin(), [](unsigned char c) {
+        return static_cast<char>(std::tolower(c));
+    });
+    return crs_dir / (curve_name + "_point_table.dat");
+}
+
+template <typename Curve>
+std::shared_ptr<const typename Curve::AffineElement[]> PointTableCache<Curve>::load(
+    const std::filesystem::path& cache_path, size_t num_points, uint64_t transcript_digest)
+{
+#ifdef __wasm__
+    static_cast<void>(cache_path);
+    static_cast<void>(num_points);
+    static_cast<void>(transcript_digest);
+    return nullptr;
+#else
+    const int fd = ::open(cache_path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return nullptr;
+    }
+    size_t file_size = 0;
+    const auto header = read_valid_header<Curve>(fd, transcript_digest, file_size);
+    if (!header || header->num_points < num_points) {
+        ::close(fd);
+        return nullptr;
+    }
+
+    void* mapping = ::mmap(nullptr, file_size, PROT_READ, MAP_SHARED, fd, 0);
+    // The mapping stays valid after the descriptor is closed
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+        return nullptr;
+    }
+    vinfo("using cached ", Curve::name, " point table of size ", header->num_points, " at ", cache_path.string());
+    const auto* points =
+        reinterpret_cast<const AffineElement*>(static_cast<const uint8_t*>(mapping) + sizeof(PointTableCacheHeader));
+    return std::shared_ptr<const AffineElement[]>(points, [mapping, file_size](const AffineElement*) {
+        ::munmap(mapping, file_size);
+    });
+#endif
+}
+
+template <typename Curve>
+bool PointTableCache<Curve>::store(const std::filesystem::path& cache_path, std::span<const AffineElement> point_table)
+{
+#ifdef __wasm__
+    static_cast<void>(cache_path);
+    static_cast<void>(point_table);
+    return false;
+#else
+    const size_t num_points = point_table.size() / 2;
+    if (num_points < DIGEST_NUM_POINTS) {
+        return false;
+    }
+    std::array<AffineElement, DIGEST_NUM_POINTS> srs_points;
+    for (size_t i = 0; i < DIGEST_NUM_POINTS; ++i) {
+        srs_points[i] = point_table[2 * i];
+    }
+    const uint64_t transcript_digest = compute_digest(srs_points);
+
+    // Every size is only written once, even if several processes miss the cache at the same time
+    if (const int fd = ::open(cache_path.c_str(), O_RDONLY | O_CLOEXEC); fd >= 0) {
+        size_t file_size = 0;
+        const auto existing = read_valid_header<Curve>(fd, transcript_digest, file_size);
+        ::close(fd);
+        if (existing && existing->num_points >= num_points) {
+            return true;
+        }
+    }
+
+    // Write to a process-specific temporary file and rename it into place, so that concurrent readers and writers
+    // only ever see complete files.
+    const std::filesystem::path tmp_path = cache_path.string() + ".tmp." + std::to_string(::getpid());
+    const PointTableCacheHeader header = make_header<Curve>(num_points, transcript_digest);
+    {
+        std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(point_table.data()),
+                   static_cast<std::streamsize>(point_table.size() * sizeof(AffineElement)));
+        if (!file) {
+            std::error_code ec;
+            std::filesystem::remove(tmp_path, ec);
+            return false;
+        }
+    }
+    std::error_code ec;
+    std::filesystem::rename(tmp_path, cache_path, ec);
+    if (ec) {
+        std::filesystem::remove(tmp_path, ec);
+        return false;
+    }
+    vinfo("wrote ", Curve::name, " point table of size ", header.num_points, " to ", cache_path.string());
+    return true;
+#endif
+}
+
+template class PointTableCache<curve::BN254>;
+template class PointTableCache<curve::Grumpkin>;
+
+} // namespace bb::srs
@@ -0,0 +1,87 @@
+#pragma once
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <span>
+
+namespace bb::srs {
+
+/**
+ * @brief Header of a point table cache file, padded to 64 bytes so that the points that follow stay aligned
+ */
+struct PointTableCacheHeader {
+    static constexpr uint64_t MAGIC = 0x454c4241545450bb; // "\xbbPTTABLE" in little endian
+    static constexpr uint64_t VERSION = 2;
+
+    uint64_t magic;
+    uint64_t version;
+    // Lowest limb of the base field modulus, to tell the curves apart
+    uint64_t curve_tag;
+    uint64_t element_size;
+    uint64_t num_points;
+    // PointTableCache::compute_digest of the SRS points the table was computed from
+    uint64_t transcript_digest;
+    uint64_t reserved[2];
+};
+static_assert(sizeof(PointTableCacheHeader) == 64);
+
+/**
+ * @brief A file cache of pippenger point tables in native layout
+ *
+ * @details The file consists of a PointTableCacheHeader followed by the 2 * num_points affine elements of the point
+ * table exactly as they are laid out in memory: in Montgomery form and host byte order, with the SRS point Gᵢ at index
+ * 2i and its endomorphism image (βx, -y) at index 2i + 1. A table for n points is a valid table for any m <= n points.
+ *
+ * Loading a cached table is a read-only mmap: there is no parsing, no byte swapping and no endomorphism computation,
+ * the points are only paged in when an MSM touches them, and all processes mapping the same file share the same
+ * physical pages through the page cache.
+ *
+ * Files written on a host with a different byte order, for a different curve or from a different transcript (as told
+ * by a digest of its first points) fail validation and are ignored. The cache is not available in WASM builds, where
+ * `load` always misses and `store` does nothing.
+ */
+template <typename Curve> class PointTableCache {
+  public:
+    using AffineElement = typename Curve::AffineElement;
+
+    // Number of leading SRS points covered by the transcript digest
+    static constexpr size_t DIGEST_NUM_POINTS = 4;
+
+    /**
+     * @brief Digest of the first DIGEST_NUM_POINTS points of an SRS, which identifies the transcript a table was
+     * computed from. Not a cryptographic hash: it only guards against stale or mismatched cache files.
+     */
+    static uint64_t compute_digest(std::span<const AffineElement> srs_points);
+
+    /**
+     * @brief The cache file location for a CRS directory, e.g. <crs_dir>/bn254_point_table.dat
+     */
+    static std::filesystem::path get_path(const std::filesystem::path& crs_dir);
+
+    /**
+     * @brief Map the point table for the first num_points points of a cache file
+     *
+     * @param transcript_digest compute_digest of the first points of the transcript the table must come from
+     * @return The point table (2 * num_points elements, read-only), or nullptr if the file does not exist, is invalid,
+     * was computed from another transcript or contains fewer than num_points points. The mapping is released when the
+     * last copy of the pointer is dropped.
+     */
+    static std::shared_ptr<const AffineElement[]> load(const std::filesystem::path& cache_path,
+                                                       size_t num_points,
+                                                       uint64_t transcript_digest);
+
+    /**
+     * @brief Atomically write a cache file from a point table of 2 * num_points elements, unless the file already holds
+     * a table of the same transcript with at least as many points
+     * @details Tables of fewer than DIGEST_NUM_POINTS points are not cached.
+     *
+     * @return Whether the file holds the table afterwards. Failing to write the cache (e.g. a read-only CRS directory)
+     * is not an error.
+     */
+    static bool store(const std::filesystem::path& cache_path, std::span<const AffineElement> point_table);
+};
+
+} // namespace bb::srs
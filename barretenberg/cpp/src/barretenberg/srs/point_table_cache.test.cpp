@@ -0,0 +1,127 @@
+#include "point_table_cache.hpp"
+#include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+
+#include <chrono>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <unistd.h>
+#include <vector>
+
+using namespace bb;
+
+namespace {
+auto& engine = numeric::get_debug_randomness();
+
+class PointTableCacheTest : public ::testing::Test {
+  protected:
+    void SetUp() override
+    {
+        dir = std::filesystem::temp_directory_path() / ("bb_point_table_cache_test_" + std::to_string(::getpid()));
+        std::filesystem::create_directories(dir);
+    }
+    void TearDown() override { std::filesystem::remove_all(dir); }
+
+    template <typename Curve> static std::vector<typename Curve::AffineElement> generate_point_table(size_t num_points)
+    {
+        std::vector<typename Curve::AffineElement> table(2 * num_points);
+        for (size_t i = 0; i < num_points; ++i) {
+            table[i] = Curve::AffineElement::random_element(&engine);
+        }
+        scalar_multiplication::generate_pippenger_point_table<Curve>(table.data(), table.data(), num_points);
+        return table;
+    }
+
+    // The digest of the SRS points a point table was computed from
+    template <typename Curve> static uint64_t digest_of(const std::vector<typename Curve::AffineElement>& table)
+    {
+        std::vector<typename Curve::AffineElement> srs_points;
+        for (size_t i = 0; i < table.size(); i += 2) {
+            srs_points.push_back(table[i]);
+        }
+        return srs::PointTableCache<Curve>::compute_digest(srs_points);
+    }
+
+    std::filesystem::path dir;
+};
+} // namespace
+
+TEST_F(PointTableCacheTest, StoreAndLoad)
+{
+    using Cache = srs::PointTableCache<curve::BN254>;
+    const size_t num_points = 1000;
+    auto table = generate_point_table<curve::BN254>(num_points);
+    const auto path = Cache::get_path(dir);
+    EXPECT_EQ(path.filename(), "bn254_point_table.dat");
+
+    const uint64_t digest = digest_of<curve::BN254>(table);
+
+    EXPECT_FALSE(Cache::load(path, 1, digest));
+    ASSERT_TRUE(Cache::store(path, table));
+
+    // A table for n points serves any request for at most n points
+    for (size_t requested : { num_points, num_points / 3 }) {
+        auto loaded = Cache::load(path, requested, digest);
+        ASSERT_TRUE(loaded);
+        for (size_t i = 0; i < 2 * requested; ++i) {
+            EXPECT_EQ(loaded[i], table[i]);
+        }
+    }
+    EXPECT_FALSE(Cache::load(path, num_points + 1, digest));
+}
+
+TEST_F(PointTableCacheTest, RejectsOtherTranscript)
+{
+    using Cache = srs::PointTableCache<curve::BN254>;
+    auto table = generate_point_table<curve::BN254>(16);
+    auto other_table = generate_point_table<curve::BN254>(16);
+    const auto path = Cache::get_path(dir);
+    ASSERT_TRUE(Cache::store(path, table));
+    EXPECT_TRUE(Cache::load(path, 16, digest_of<curve::BN254>(table)));
+    EXPECT_FALSE(Cache::load(path, 16, digest_of<curve::BN254>(other_table)));
+
+    // A table of another transcript replaces the file
+    ASSERT_TRUE(Cache::store(path, other_table));
+    EXPECT_TRUE(Cache::load(path, 16, digest_of<curve::BN254>(other_table)));
+}
+
+TEST_F(PointTableCacheTest, WritesEachSizeOnce)
+{
+    using Cache = srs::PointTableCache<curve::BN254>;
+    auto table = generate_point_table<curve::BN254>(64);
+    const auto path = Cache::get_path(dir);
+    ASSERT_TRUE(Cache::store(path, table));
+    const auto write_time = std::filesystem::last_write_time(path);
+
+    // Storing the same or a smaller table leaves the file alone
+    std::filesystem::last_write_time(path, write_time - std::chrono::hours(1));
+    EXPECT_TRUE(Cache::store(path, table));
+    EXPECT_TRUE(Cache::store(path, std::span(table).first(32)));
+    EXPECT_EQ(std::filesystem::last_write_time(path), write_time - std::chrono::hours(1));
+
+    // A larger table of the same transcript is written
+    auto larger_table = generate_point_table<curve::BN254>(128);
+    std::copy(table.begin(), table.end(), larger_table.begin());
+    ASSERT_TRUE(Cache::store(path, larger_table));
+    EXPECT_TRUE(Cache::load(path, 128, digest_of<curve::BN254>(table)));
+}
+
+TEST_F(PointTableCacheTest, RejectsOtherCurve)
+{
+    auto table = generate_point_table<curve::Grumpkin>(16);
+    const auto path = dir / "table.dat";
+    const uint64_t digest = digest_of<curve::Grumpkin>(table);
+    ASSERT_TRUE(srs::PointTableCache<curve::Grumpkin>::store(path, table));
+    EXPECT_TRUE(srs::PointTableCache<curve::Grumpkin>::load(path, 16, digest));
+    EXPECT_FALSE(srs::PointTableCache<curve::BN254>::load(path, 16, digest));
+}
+
+TEST_F(PointTableCacheTest, RejectsTruncatedFile)
+{
+    using Cache = srs::PointTableCache<curve::BN254>;
+    auto table = generate_point_table<curve::BN254>(16);
+    const auto path = Cache::get_path(dir);
+    ASSERT_TRUE(Cache::store(path, table));
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 1);
+    EXPECT_FALSE(Cache::load(path, 1, digest_of<curve::BN254>(table)));
+}
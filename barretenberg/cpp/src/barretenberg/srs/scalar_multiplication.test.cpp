@@ -71,7 +71,7 @@ TYPED_TEST(ScalarMultiplicationTests, ReduceBucketsSimple)
         TestFixture::read_transcript_g2(TestFixture::SRS_PATH);
     }
     auto crs = srs::factories::FileProverCrs<Curve>(num_points / 2, TestFixture::SRS_PATH);
-    std::span<AffineElement> monomials = crs.get_monomial_points();
+    std::span<const AffineElement> monomials = crs.get_monomial_points();
 
     std::vector<uint64_t> point_schedule(bb::scalar_multiplication::point_table_size(num_points / 2));
     std::array<bool, num_points> bucket_empty_status;
@@ -603,6 +603,37 @@ TYPED_TEST(ScalarMultiplicationTests, EndomorphismSplit)
     EXPECT_EQ(result == expected, true);
 }
 
+TYPED_TEST(ScalarMultiplicationTests, GeneratePointTable)
+{
+    using Curve = TypeParam;
+    using AffineElement = typename Curve::AffineElement;
+    using Fq = typename Curve::BaseField;
+
+    const Fq beta = Fq::cube_root_of_unity();
+    // Sizes around the level boundaries of the in-place construction, and one large enough to be multithreaded
+    for (size_t num_points : { 1UL, 2UL, 3UL, 4UL, 5UL, 17UL, 1UL << 14 }) {
+        std::vector<AffineElement> points(num_points);
+        for (auto& point : points) {
+            point = AffineElement::random_element(&engine);
+        }
+        std::vector<AffineElement> table(2 * num_points);
+        std::vector<AffineElement> in_place_table(2 * num_points);
+        std::copy(points.begin(), points.end(), in_place_table.begin());
+
+        scalar_multiplication::generate_pippenger_point_table<Curve>(points.data(), table.data(), num_points);
+        scalar_multiplication::generate_pippenger_point_table<Curve>(
+            in_place_table.data(), in_place_table.data(), num_points);
+
+        for (size_t i = 0; i < num_points; ++i) {
+            const AffineElement endo_point{ beta * points[i].x, -points[i].y };
+            EXPECT_EQ(table[2 * i], points[i]);
+            EXPECT_EQ(table[2 * i + 1], endo_point);
+            EXPECT_EQ(in_place_table[2 * i], points[i]);
+            EXPECT_EQ(in_place_table[2 * i + 1], endo_point);
+        }
+    }
+}
+
 TYPED_TEST(ScalarMultiplicationTests, RadixSort)
 {
     using Curve = TypeParam;
@@ -70,6 +70,26 @@ TEST_F(PermutationHelperTests, ComputePermutationMapping)
     compute_permutation_mapping<Flavor, /*generalized=*/false>(circuit_constructor, proving_key.get(), {});
 }
 
+TEST_F(PermutationHelperTests, ComputePermutationMappingFromCopyCycles)
+{
+    // A cycle with a single node, an empty cycle and a cycle with three nodes
+    CopyCycles copy_cycles{ .nodes = { { 0, 5 }, { 1, 6 }, { 2, 7 }, { 0, 8 } }, .offsets = { 0, 1, 1, 4 } };
+    EXPECT_EQ(copy_cycles.size(), 3);
+    EXPECT_TRUE(copy_cycles[1].empty());
+
+    auto mapping =
+        compute_permutation_mapping<Flavor, /*generalized=*/false>(circuit_constructor, proving_key.get(), copy_cycles);
+    // Each node points to the next node of its cycle, and the last one to the first
+    EXPECT_EQ(mapping.sigmas[0].row_idx[5], 5);
+    EXPECT_EQ(mapping.sigmas[0].col_idx[5], 0);
+    EXPECT_EQ(mapping.sigmas[1].row_idx[6], 7);
+    EXPECT_EQ(mapping.sigmas[1].col_idx[6], 2);
+    EXPECT_EQ(mapping.sigmas[2].row_idx[7], 8);
+    EXPECT_EQ(mapping.sigmas[2].col_idx[7], 0);
+    EXPECT_EQ(mapping.sigmas[0].row_idx[8], 6);
+    EXPECT_EQ(mapping.sigmas[0].col_idx[8], 1);
+}
+
 TEST_F(PermutationHelperTests, ComputeHonkStyleSigmaLagrangePolynomialsFromMapping)
 {
     // TODO(#425) Flesh out these tests
@@ -600,8 +600,8 @@ void UltraCircuitBuilder_<ExecutionTrace>::create_ecc_add_gate(const ecc_add_gat
     }
 
     if (can_fuse_into_previous_gate) {
-        block.q_1()[block.size() - 1] = in.sign_coefficient;
-        block.q_elliptic()[block.size() - 1] = 1;
+        block.q_1().set_back(in.sign_coefficient);
+        block.q_elliptic().set_back(1);
     } else {
         block.populate_wires(this->zero_idx, in.x1, in.y1, this->zero_idx);
         block.q_3().emplace_back(0);
@@ -658,8 +658,8 @@ void UltraCircuitBuilder_<ExecutionTrace>::create_ecc_dbl_gate(const ecc_dbl_gat
     }
 
     if (can_fuse_into_previous_gate) {
-        block.q_elliptic()[block.size() - 1] = 1;
-        block.q_m()[block.size() - 1] = 1;
+        block.q_elliptic().set_back(1);
+        block.q_m().set_back(1);
     } else {
         block.populate_wires(this->zero_idx, in.x1, in.y1, this->zero_idx);
         block.q_elliptic().emplace_back(1);
@@ -2874,7 +2874,11 @@ template <typename ExecutionTrace> uint256_t UltraCircuitBuilder_<ExecutionTrace
     };
 
     for (auto& block : blocks.get()) {
-        std::for_each(block.selectors.begin(), block.selectors.end(), convert_and_insert);
+        for (const auto& selector : block.selectors) {
+            // Prefixed with its size, as the wires are
+            std::vector<uint8_t> buffer = to_buffer</*include_size=*/true>(selector.to_vector());
+            to_hash.insert(to_hash.end(), buffer.begin(), buffer.end());
+        }
         std::for_each(block.wires.begin(), block.wires.end(), convert_and_insert);
     }
     convert_and_insert(this->real_variable_index);
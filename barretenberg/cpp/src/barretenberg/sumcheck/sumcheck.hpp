@@ -1,4 +1,5 @@
 #pragma once
+#include "barretenberg/common/stats.hpp"
 #include "barretenberg/plonk_honk_shared/library/grand_product_delta.hpp"
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
 #include "barretenberg/sumcheck/sumcheck_output.hpp"
@@ -8,6 +9,16 @@
 
 namespace bb {
 
+/**
+ * @brief Configuration of the streaming mode of the sumcheck prover, see SumcheckProver::prove_streaming
+ */
+struct SumcheckStreamingConfig {
+    // Memory available for the book-keeping table of partially evaluated polynomials, in bytes
+    size_t memory_budget = 0;
+    // Number of rows of the prover polynomials requested from the row producer at a time
+    size_t chunk_size = static_cast<size_t>(1) << 16;
+};
+
 /*! \brief The implementation of the sumcheck Prover for statements of the form \f$\sum_{\vec \ell \in \{0,1\}^d}
 pow_{\beta}(\vec \ell) \cdot F \left(P_1(\vec \ell),\ldots, P_N(\vec \ell) \right)  = 0 \f$ for multilinear polynomials
 \f$P_1, \ldots, P_N \f$.
@@ -171,7 +182,11 @@ template <typename Flavor> class SumcheckProver {
         : multivariate_n(multivariate_n)
         , multivariate_d(numeric::get_msb(multivariate_n))
         , transcript(transcript)
-        , round(multivariate_n){};
+        , round(multivariate_n)
+    {
+        BB_STATS_ADD("sumcheck/count", 1);
+        BB_STATS_MAX("sumcheck/max_rows", multivariate_n);
+    };
 
     /**
      * @brief Non-ZK version: Compute round univariate, place it in transcript, compute challenge, partially evaluate.
@@ -249,6 +264,140 @@ template <typename Flavor> class SumcheckProver {
         vinfo("finished sumcheck");
     };
 
+    /**
+     * @brief Produces rows \f$ \texttt{start_row},\ldots, \texttt{start_row} + c - 1 \f$ of all prover polynomials,
+     * shifts included, into rows \f$ 0,\ldots, c - 1 \f$ of \p chunk, where \f$ c \f$ is the size of the chunk
+     * polynomials. Rows past the end of a polynomial are zero.
+     */
+    using RowChunkProducer = std::function<void(size_t start_row, PartiallyEvaluatedMultivariates& chunk)>;
+
+    /**
+     * @brief A RowChunkProducer reading from prover polynomials held in memory
+     */
+    static RowChunkProducer make_row_chunk_producer(const ProverPolynomials& full_polynomials)
+    {
+        return [&full_polynomials](size_t start_row, PartiallyEvaluatedMultivariates& chunk) {
+            auto chunk_view = chunk.get_all();
+            auto full_view = full_polynomials.get_all();
+            parallel_for(chunk_view.size(), [&](size_t j) {
+                for (size_t i = 0; i < chunk_view[j].size(); i++) {
+                    chunk_view[j].at(i) = full_view[j].get(start_row + i);
+                }
+            });
+        };
+    }
+
+    /**
+     * @brief The number of rounds prove_streaming runs before the book-keeping table fits in the memory budget
+     */
+    size_t compute_num_streaming_rounds(size_t memory_budget) const
+    {
+        const auto table_size = [](size_t num_rows) { return Flavor::NUM_ALL_ENTITIES * num_rows * sizeof(FF); };
+        size_t num_rounds = 1;
+        while (num_rounds + 1 < multivariate_d && table_size(multivariate_n >> num_rounds) > memory_budget) {
+            num_rounds++;
+        }
+        return num_rounds;
+    }
+
+    /**
+     * @brief Non-ZK version of `prove` for prover polynomials that do not fit in memory.
+     * @details The prover polynomials are read in chunks of rows from \p produce_rows, so they need not be held in
+     * memory. In a streaming round \f$ i \f$, every chunk of \f$ c \f$ rows is folded at the challenges \f$
+     * u_0,\ldots, u_{i-1} \f$, which yields \f$ c/2^i \f$ consecutive rows of the round's book-keeping table, and their
+     * contribution to the round univariate is accumulated. Streaming continues until the table of
+     * #partially_evaluated_polynomials fits in the memory budget, at which point it is materialized from one more
+     * pass over the rows and the remaining rounds run in memory as in `prove`.
+     *
+     * Each streaming round reads every row once, so with \f$ k \f$ streaming rounds the prover polynomials are read
+     * \f$ k + 1 \f$ times, in exchange for a peak memory of the chunk plus a table of \f$ n/2^k \f$ rows instead of
+     * \f$ n/2 \f$ rows. The transcript and the output are identical to those of `prove`.
+     *
+     * @param produce_rows Source of the rows of the prover polynomials
+     * @param config Memory budget for the book-keeping table and chunk size
+     */
+    SumcheckOutput<Flavor> prove_streaming(const RowChunkProducer& produce_rows,
+                                           const bb::RelationParameters<FF>& relation_parameters,
+                                           const RelationSeparator alpha,
+                                           const std::vector<FF>& gate_challenges,
+                                           const SumcheckStreamingConfig& config)
+    {
+        ASSERT(multivariate_d >= 2);
+        bb::GateSeparatorPolynomial<FF> gate_separators(gate_challenges, multivariate_d);
+
+        multivariate_challenge.reserve(multivariate_d);
+        const size_t num_streaming_rounds = compute_num_streaming_rounds(config.memory_budget);
+        // A chunk has to be folded num_streaming_rounds times to materialize the table, hence the minimal size
+        const size_t min_chunk_size = static_cast<size_t>(1) << num_streaming_rounds;
+        const size_t chunk_size =
+            std::min(multivariate_n, std::max(numeric::round_up_power_2(config.chunk_size), min_chunk_size));
+        vinfo("streaming ", num_streaming_rounds, " sumcheck rounds in chunks of ", chunk_size, " rows");
+        {
+            PartiallyEvaluatedMultivariates chunk(2 * chunk_size);
+            for (size_t round_idx = 0; round_idx < num_streaming_rounds; round_idx++) {
+                PROFILE_THIS_NAME("streaming sumcheck round");
+
+                for (size_t start_row = 0; start_row < multivariate_n; start_row += chunk_size) {
+                    produce_rows(start_row, chunk);
+                    fold_chunk(chunk, chunk_size, round_idx);
+                    round.accumulate_block(
+                        chunk, chunk_size >> round_idx, start_row >> round_idx, relation_parameters, gate_separators);
+                }
+                auto round_univariate = round.template batch_over_relations<SumcheckRoundUnivariate>(
+                    round.univariate_accumulators, alpha, gate_separators);
+                transcript->send_to_verifier("Sumcheck:univariate_" + std::to_string(round_idx), round_univariate);
+                FF round_challenge =
+                    transcript->template get_challenge<FF>("Sumcheck:u_" + std::to_string(round_idx));
+                multivariate_challenge.emplace_back(round_challenge);
+                gate_separators.partially_evaluate(round_challenge);
+                round.round_size = round.round_size >> 1;
+            }
+
+            PROFILE_THIS_NAME("materialize partially evaluated polynomials");
+            // The constructor allocates tables of half the given size
+            partially_evaluated_polynomials = PartiallyEvaluatedMultivariates(round.round_size * 2);
+            const size_t folded_chunk_size = chunk_size >> num_streaming_rounds;
+            for (size_t start_row = 0; start_row < multivariate_n; start_row += chunk_size) {
+                produce_rows(start_row, chunk);
+                fold_chunk(chunk, chunk_size, num_streaming_rounds);
+                auto pep_view = partially_evaluated_polynomials.get_all();
+                auto chunk_view = chunk.get_all();
+                parallel_for(pep_view.size(), [&](size_t j) {
+                    std::copy_n(chunk_view[j].data(),
+                                folded_chunk_size,
+                                pep_view[j].data() + (start_row >> num_streaming_rounds));
+                });
+            }
+        }
+
+        for (size_t round_idx = num_streaming_rounds; round_idx < multivariate_d; round_idx++) {
+            PROFILE_THIS_NAME("sumcheck loop");
+
+            auto round_univariate =
+                round.compute_univariate(partially_evaluated_polynomials, relation_parameters, gate_separators, alpha);
+            transcript->send_to_verifier("Sumcheck:univariate_" + std::to_string(round_idx), round_univariate);
+            FF round_challenge = transcript->template get_challenge<FF>("Sumcheck:u_" + std::to_string(round_idx));
+            multivariate_challenge.emplace_back(round_challenge);
+            partially_evaluate(partially_evaluated_polynomials, round_challenge);
+            gate_separators.partially_evaluate(round_challenge);
+            round.round_size = round.round_size >> 1;
+        }
+        vinfo("completed ", multivariate_d, " rounds of sumcheck");
+
+        // Zero univariates are used to pad the proof to the fixed size CONST_PROOF_SIZE_LOG_N.
+        auto zero_univariate = bb::Univariate<FF, Flavor::BATCHED_RELATION_PARTIAL_LENGTH>::zero();
+        for (size_t idx = multivariate_d; idx < CONST_PROOF_SIZE_LOG_N; idx++) {
+            transcript->send_to_verifier("Sumcheck:univariate_" + std::to_string(idx), zero_univariate);
+            FF round_challenge = transcript->template get_challenge<FF>("Sumcheck:u_" + std::to_string(idx));
+            multivariate_challenge.emplace_back(round_challenge);
+        }
+        ClaimedEvaluations multivariate_evaluations = extract_claimed_evaluations(partially_evaluated_polynomials);
+        transcript->send_to_verifier("Sumcheck:evaluations", multivariate_evaluations.get_all());
+
+        return SumcheckOutput<Flavor>{ .challenge = multivariate_challenge,
+                                       .claimed_evaluations = multivariate_evaluations };
+    };
+
     /**
      * @brief ZK-version of `prove` that runs Sumcheck with disabled rows and masking of Round Univariates.
      * The masking is ensured by adding random Libra univariates to the Sumcheck round univariates.
@@ -494,6 +643,27 @@ template <typename Flavor> class SumcheckProver {
         });
     };
 
+    /**
+     * @brief Fold the rows of a chunk of the prover polynomials at the first \p num_challenges challenges, in place.
+     * @details Afterwards the first \f$ \texttt{chunk_size}/2^{\texttt{num_challenges}} \f$ rows of \p chunk hold the
+     * corresponding rows of the book-keeping table of round \p num_challenges, see \ref partially_evaluate
+     * "partially evaluate".
+     */
+    void fold_chunk(PartiallyEvaluatedMultivariates& chunk, size_t chunk_size, size_t num_challenges)
+    {
+        auto chunk_view = chunk.get_all();
+        parallel_for(chunk_view.size(), [&](size_t j) {
+            auto& poly = chunk_view[j];
+            for (size_t challenge_idx = 0; challenge_idx < num_challenges; challenge_idx++) {
+                const FF& challenge = multivariate_challenge[challenge_idx];
+                const size_t folded_size = chunk_size >> (challenge_idx + 1);
+                for (size_t i = 0; i < folded_size; i++) {
+                    poly.at(i) = poly[2 * i] + challenge * (poly[2 * i + 1] - poly[2 * i]);
+                }
+            }
+        });
+    }
+
     /**
      * @brief This method takes the book-keeping table containing partially evaluated prover polynomials and creates a
      * vector containing the evaluations of all prover polynomials at the point \f$ (u_0, \ldots, u_{d-1} )\f$.
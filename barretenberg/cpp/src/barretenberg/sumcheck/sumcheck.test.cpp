@@ -172,6 +172,119 @@ template <typename Flavor> class SumcheckTests : public ::testing::Test {
         }
     }
 
+    void test_streaming_prover()
+    {
+        const size_t multivariate_d(7);
+        const size_t multivariate_n(1 << multivariate_d);
+
+        // Polynomials of varying length, so that chunks past the end of some of them are produced
+        std::vector<Polynomial<FF>> random_polynomials(NUM_POLYNOMIALS);
+        for (size_t idx = 0; idx < random_polynomials.size(); idx++) {
+            const size_t size = multivariate_n - 13 * (idx % 5);
+            random_polynomials[idx] = Polynomial<FF>(size, multivariate_n);
+            for (auto& coeff : random_polynomials[idx].coeffs()) {
+                coeff = FF::random_element();
+            }
+        }
+        auto full_polynomials = construct_ultra_full_polynomials(random_polynomials);
+
+        const auto run_sumcheck = [&](bool streaming) {
+            auto transcript = Flavor::Transcript::prover_init_empty();
+            auto sumcheck = SumcheckProver<Flavor>(multivariate_n, transcript);
+            RelationSeparator alpha;
+            for (size_t idx = 0; idx < alpha.size(); idx++) {
+                alpha[idx] = transcript->template get_challenge<FF>("Sumcheck:alpha_" + std::to_string(idx));
+            }
+            std::vector<FF> gate_challenges(multivariate_d);
+            for (size_t idx = 0; idx < multivariate_d; idx++) {
+                gate_challenges[idx] =
+                    transcript->template get_challenge<FF>("Sumcheck:gate_challenge_" + std::to_string(idx));
+            }
+            if (!streaming) {
+                return sumcheck.prove(full_polynomials, {}, alpha, gate_challenges);
+            }
+            // Stream until the table has n/8 rows, in chunks of 16 rows
+            const SumcheckStreamingConfig config{ .memory_budget = NUM_POLYNOMIALS * (multivariate_n >> 3) * sizeof(FF),
+                                                  .chunk_size = 16 };
+            EXPECT_EQ(sumcheck.compute_num_streaming_rounds(config.memory_budget), 3);
+            return sumcheck.prove_streaming(SumcheckProver<Flavor>::make_row_chunk_producer(full_polynomials),
+                                            {},
+                                            alpha,
+                                            gate_challenges,
+                                            config);
+        };
+
+        // Same transcript, hence same round univariates, and same evaluations
+        auto output = run_sumcheck(false);
+        auto streaming_output = run_sumcheck(true);
+        EXPECT_EQ(streaming_output.challenge, output.challenge);
+        for (auto [streaming_eval, eval] :
+             zip_view(streaming_output.claimed_evaluations.get_all(), output.claimed_evaluations.get_all())) {
+            EXPECT_EQ(streaming_eval, eval);
+        }
+    }
+
+    void test_active_ranges()
+    {
+        const size_t multivariate_d(7);
+        const size_t multivariate_n(1 << multivariate_d);
+
+        // Every unshifted polynomial vanishes outside of the active ranges, as in the unused blocks of a structured
+        // trace, and the shifted polynomials are their shifts. The ranges are separated by gaps of inactive edges, and
+        // the row before a range starting on an even row is in an edge of its own, which only its shifted entries make
+        // active. The first two ranges only meet after folding.
+        const std::vector<std::pair<size_t, size_t>> active_ranges{ { 71, 90 }, { 5, 21 }, { 26, 33 }, { 100, 110 } };
+        std::vector<Polynomial<FF>> random_polynomials(NUM_POLYNOMIALS);
+        for (auto& poly : random_polynomials) {
+            poly = Polynomial<FF>(multivariate_n);
+            for (const auto& [start, end] : active_ranges) {
+                for (size_t i = start; i < end; i++) {
+                    poly.at(i) = FF::random_element();
+                }
+            }
+        }
+        auto full_polynomials = construct_ultra_full_polynomials(random_polynomials);
+        for (auto [shifted, to_be_shifted] :
+             zip_view(full_polynomials.get_shifted(), full_polynomials.get_to_be_shifted())) {
+            shifted = Polynomial<FF>(multivariate_n);
+            for (size_t i = 0; i + 1 < multivariate_n; i++) {
+                shifted.at(i) = to_be_shifted[i + 1];
+            }
+        }
+
+        // Non-trivial parameters, so that e.g. the permutation relation does not vanish just before a range
+        const auto relation_parameters = RelationParameters<FF>::get_random();
+        const auto run_sumcheck = [&](bool skip_inactive_edges) {
+            auto transcript = Flavor::Transcript::prover_init_empty();
+            auto sumcheck = SumcheckProver<Flavor>(multivariate_n, transcript);
+            if (skip_inactive_edges) {
+                sumcheck.round.set_active_ranges(active_ranges);
+                // Round 0 only visits the edge pairs intersecting the ranges or the rows just before them
+                const std::vector<std::pair<size_t, size_t>> expected_edge_ranges{
+                    { 4, 22 }, { 24, 34 }, { 70, 90 }, { 98, 110 }
+                };
+                EXPECT_EQ(sumcheck.round.compute_active_edge_ranges(), expected_edge_ranges);
+            }
+            RelationSeparator alpha;
+            for (size_t idx = 0; idx < alpha.size(); idx++) {
+                alpha[idx] = transcript->template get_challenge<FF>("Sumcheck:alpha_" + std::to_string(idx));
+            }
+            std::vector<FF> gate_challenges(multivariate_d);
+            for (size_t idx = 0; idx < multivariate_d; idx++) {
+                gate_challenges[idx] =
+                    transcript->template get_challenge<FF>("Sumcheck:gate_challenge_" + std::to_string(idx));
+            }
+            auto output = sumcheck.prove(full_polynomials, relation_parameters, alpha, gate_challenges);
+            return std::make_pair(output, transcript->export_proof());
+        };
+
+        // Skipping the inactive edges leaves the proof unchanged
+        auto [output, proof] = run_sumcheck(false);
+        auto [skipping_output, skipping_proof] = run_sumcheck(true);
+        EXPECT_EQ(skipping_proof, proof);
+        EXPECT_EQ(skipping_output.challenge, output.challenge);
+    }
+
     // TODO(#225): make the inputs to this test more interesting, e.g. non-trivial permutations
     void test_prover_verifier_flow()
     {
@@ -397,6 +510,24 @@ TYPED_TEST(SumcheckTests, Prover)
 {
     this->test_prover();
 }
+// Test that the streaming prover agrees with the in-memory prover
+TYPED_TEST(SumcheckTests, StreamingProver)
+{
+    if constexpr (!TypeParam::HasZK) {
+        this->test_streaming_prover();
+    } else {
+        GTEST_SKIP() << "Streaming is not supported for ZK-enabled flavors";
+    }
+}
+// Test that skipping the edges outside of the active ranges does not change the proof
+TYPED_TEST(SumcheckTests, ActiveRanges)
+{
+    if constexpr (!TypeParam::HasZK) {
+        this->test_active_ranges();
+    } else {
+        GTEST_SKIP() << "Skipping inactive edges is not supported for ZK-enabled flavors";
+    }
+}
 // Tests the prover-verifier flow
 TYPED_TEST(SumcheckTests, ProverAndVerifierSimple)
 {
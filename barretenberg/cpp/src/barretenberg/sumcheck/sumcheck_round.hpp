@@ -75,6 +75,12 @@ template <typename Flavor> class SumcheckProverRound {
     // The length of the polynomials used to mask the Sumcheck Round Univariates.
     static constexpr size_t LIBRA_UNIVARIATES_LENGTH = Flavor::Curve::LIBRA_UNIVARIATES_LENGTH;
 
+    using Range = std::pair<size_t, size_t>;
+    // Sorted disjoint ranges of rows of the table of size active_ranges_round_size outside of which every relation
+    // vanishes identically, see set_active_ranges. Empty if every row is potentially active.
+    std::vector<Range> active_ranges;
+    size_t active_ranges_round_size = 0;
+
     // Prover constructor
     SumcheckProverRound(size_t initial_round_size)
         : round_size(initial_round_size)
@@ -86,6 +92,74 @@ template <typename Flavor> class SumcheckProverRound {
         Utils::zero_univariates(univariate_accumulators);
     }
 
+    /**
+     * @brief Restrict the non-ZK compute_univariate to the edges that intersect the given ranges of rows of the current
+     * round's table.
+     * @details Structured execution traces leave large blocks of rows on which all selectors, wires and lookup data are
+     * zero. On such rows every relation vanishes identically, and so does it on any linear combination of two such
+     * rows: the edges of round 0 made of two inactive rows contribute nothing to the round univariate, and neither do
+     * the edges of the following rounds made of two rows folded from inactive rows only. This is the same property the
+     * Protogalaxy combiner relies on to skip the rows outside of the ExecutionTraceUsageTracker active ranges.
+     *
+     * The ranges are given once, in terms of the table of the current round; the active edges of each subsequent round
+     * are derived from them by compute_active_edge_ranges. The row just before a range is active too, since its shifted
+     * entries are read from the first row of the range.
+     *
+     * @param ranges Ranges [start, end) of rows that may contribute to the relations, in any order and possibly
+     * overlapping
+     */
+    void set_active_ranges(std::vector<Range> ranges)
+    {
+        for (auto& range : ranges) {
+            if (range.first > 0 && range.first < range.second) {
+                range.first--;
+            }
+        }
+        std::sort(ranges.begin(), ranges.end());
+        active_ranges.clear();
+        for (const auto& range : ranges) {
+            if (range.first >= range.second) {
+                continue;
+            }
+            if (!active_ranges.empty() && range.first <= active_ranges.back().second) {
+                active_ranges.back().second = std::max(active_ranges.back().second, range.second);
+            } else {
+                active_ranges.push_back(range);
+            }
+        }
+        active_ranges_round_size = round_size;
+    }
+
+    /**
+     * @brief Sorted disjoint ranges [start, end) of even edge indices of the current round whose edge pair intersects
+     * the active ranges
+     * @details Row \f$ r \f$ of the table in which the active ranges were set ends up in row \f$ \lfloor r / 2^s
+     * \rfloor \f$ after \f$ s \f$ rounds of folding, so range \f$ [a, b) \f$ becomes \f$ [\lfloor a / 2^s \rfloor,
+     * \lceil b / 2^s \rceil) \f$, widened to whole edge pairs.
+     */
+    std::vector<Range> compute_active_edge_ranges() const
+    {
+        const size_t num_folds =
+            numeric::get_msb(active_ranges_round_size) - numeric::get_msb(std::max(round_size, size_t{ 1 }));
+        const size_t fold_mask = (static_cast<size_t>(1) << num_folds) - 1;
+        std::vector<Range> edge_ranges;
+        for (const auto& [start, end] : active_ranges) {
+            const size_t edge_start = (start >> num_folds) & ~static_cast<size_t>(1);
+            const size_t folded_end = (end + fold_mask) >> num_folds;
+            const size_t edge_end = std::min(round_size, folded_end + (folded_end & 1));
+            if (edge_start >= edge_end) {
+                continue;
+            }
+            // Distinct ranges may meet once folded
+            if (!edge_ranges.empty() && edge_start <= edge_ranges.back().second) {
+                edge_ranges.back().second = std::max(edge_ranges.back().second, edge_end);
+            } else {
+                edge_ranges.emplace_back(edge_start, edge_end);
+            }
+        }
+        return edge_ranges;
+    }
+
     /**
      * @brief  To compute the round univariate in Round \f$i\f$, the prover first computes the values of Honk
      polynomials \f$ P_1,\ldots, P_N \f$ at the points of the form \f$ (u_0,\ldots, u_{i-1}, k, \vec \ell)\f$ for \f$
@@ -164,6 +238,11 @@ template <typename Flavor> class SumcheckProverRound {
     {
         PROFILE_THIS_NAME("compute_univariate");
 
+        if (!active_ranges.empty()) {
+            accumulate_active_edges(polynomials, relation_parameters, gate_separators);
+            return batch_over_relations<SumcheckRoundUnivariate>(univariate_accumulators, alpha, gate_separators);
+        }
+
         // Determine number of threads for multithreading.
         // Note: Multithreading is "on" for every round but we reduce the number of threads from the max available based
         // on a specified minimum number of iterations per thread. This eventually leads to the use of a single thread.
@@ -271,6 +350,105 @@ template <typename Flavor> class SumcheckProverRound {
         return batch_over_relations<SumcheckRoundUnivariate>(univariate_accumulators, alpha, gate_separators);
     }
 
+    /**
+     * @brief Accumulate the contributions of the edges returned by compute_active_edge_ranges to the univariate
+     * accumulators.
+     * @details The active edges, rather than the whole round, are split evenly across threads, so that the work stays
+     * balanced however the active rows are spread over the trace.
+     */
+    template <typename ProverPolynomialsOrPartiallyEvaluatedMultivariates>
+    void accumulate_active_edges(const ProverPolynomialsOrPartiallyEvaluatedMultivariates& polynomials,
+                                 const bb::RelationParameters<FF>& relation_parameters,
+                                 const bb::GateSeparatorPolynomial<FF>& gate_separators)
+    {
+        PROFILE_THIS_NAME("accumulate_active_edges");
+
+        const std::vector<Range> edge_ranges = compute_active_edge_ranges();
+        size_t num_active_edges = 0;
+        for (const auto& [start, end] : edge_ranges) {
+            num_active_edges += (end - start) / 2;
+        }
+
+        size_t min_iterations_per_thread = 1 << 5; // min number of edges for which we'll spin up a unique thread
+        size_t num_threads = bb::calculate_num_threads(num_active_edges, min_iterations_per_thread);
+        std::vector<SumcheckTupleOfTuplesOfUnivariates> thread_univariate_accumulators(num_threads);
+
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            Utils::zero_univariates(thread_univariate_accumulators[thread_idx]);
+            ExtendedEdges extended_edges;
+            // This thread processes the active edges numbered [thread_start, thread_end) across all the ranges
+            const size_t thread_start = thread_idx * num_active_edges / num_threads;
+            const size_t thread_end = (thread_idx + 1) * num_active_edges / num_threads;
+            size_t range_offset = 0;
+            for (const auto& [start, end] : edge_ranges) {
+                if (range_offset >= thread_end) {
+                    break;
+                }
+                const size_t range_end_offset = range_offset + (end - start) / 2;
+                for (size_t edge_num = std::max(thread_start, range_offset);
+                     edge_num < std::min(thread_end, range_end_offset);
+                     edge_num++) {
+                    const size_t edge_idx = start + 2 * (edge_num - range_offset);
+                    extend_edges(extended_edges, polynomials, edge_idx);
+                    accumulate_relation_univariates(thread_univariate_accumulators[thread_idx],
+                                                    extended_edges,
+                                                    relation_parameters,
+                                                    gate_separators[(edge_idx >> 1) * gate_separators.periodicity]);
+                }
+                range_offset = range_end_offset;
+            }
+        });
+
+        for (auto& accumulators : thread_univariate_accumulators) {
+            Utils::add_nested_tuples(univariate_accumulators, accumulators);
+        }
+    }
+
+    /**
+     * @brief Accumulate the contributions of a block of consecutive rows of the current round's book-keeping table to
+     * the round univariate.
+     * @details Used by the streaming rounds of SumcheckProver, where the table is never held in memory as a whole.
+     * Rows \f$ 0,\ldots, \texttt{block_size}-1 \f$ of \p polynomials hold rows \f$ \texttt{block_start},\ldots,
+     * \texttt{block_start} + \texttt{block_size}-1 \f$ of the table. Once all blocks of the round have been
+     * accumulated, the round univariate is obtained from \ref batch_over_relations "batch over relations".
+     *
+     * @param block_size Number of rows in the block, even
+     * @param block_start Index of the first row of the block in the table, even
+     */
+    template <typename ProverPolynomialsOrPartiallyEvaluatedMultivariates>
+    void accumulate_block(const ProverPolynomialsOrPartiallyEvaluatedMultivariates& polynomials,
+                          const size_t block_size,
+                          const size_t block_start,
+                          const bb::RelationParameters<FF>& relation_parameters,
+                          const bb::GateSeparatorPolynomial<FF>& gate_separators)
+    {
+        PROFILE_THIS_NAME("accumulate_block");
+
+        size_t min_iterations_per_thread = 1 << 6; // min number of iterations for which we'll spin up a unique thread
+        size_t num_threads = bb::calculate_num_threads_pow2(block_size, min_iterations_per_thread);
+        size_t iterations_per_thread = block_size / num_threads; // actual iterations per thread
+        std::vector<SumcheckTupleOfTuplesOfUnivariates> thread_univariate_accumulators(num_threads);
+
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            Utils::zero_univariates(thread_univariate_accumulators[thread_idx]);
+            ExtendedEdges extended_edges;
+            size_t start = thread_idx * iterations_per_thread;
+            size_t end = start + iterations_per_thread;
+            for (size_t edge_idx = start; edge_idx < end; edge_idx += 2) {
+                extend_edges(extended_edges, polynomials, edge_idx);
+                accumulate_relation_univariates(
+                    thread_univariate_accumulators[thread_idx],
+                    extended_edges,
+                    relation_parameters,
+                    gate_separators[((block_start + edge_idx) >> 1) * gate_separators.periodicity]);
+            }
+        });
+
+        for (auto& accumulators : thread_univariate_accumulators) {
+            Utils::add_nested_tuples(univariate_accumulators, accumulators);
+        }
+    }
+
     /**
      * @brief ZK-version of `compute_univariate` that runs Sumcheck with disabled rows and masking of Round Univariates.
      * The masking is ensured by adding random Libra univariates to the Sumcheck round univariates.
@@ -6,8 +6,102 @@
 #include "barretenberg/stdlib_circuit_builders/ultra_keccak_zk_flavor.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_rollup_flavor.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_zk_flavor.hpp"
+#include <algorithm>
+#include <array>
 namespace bb {
 
+namespace {
+// The address of a wire value in the trace, tagged with the index of the (real) variable it holds
+struct CopyCycleEntry {
+    uint32_t real_var_idx;
+    cycle_node node;
+};
+
+/**
+ * @brief Stable parallel LSD radix sort of the entries by variable
+ * @details Each pass splits the entries into contiguous chunks, counts the digits in each chunk and then scatters the
+ * chunks, in order, into the positions given by the counts. Entries holding the same variable thus keep their order.
+ */
+void sort_by_variable(std::vector<CopyCycleEntry>& entries, size_t num_variables)
+{
+    constexpr size_t RADIX_BITS = 8;
+    constexpr size_t RADIX = 1UL << RADIX_BITS;
+    const size_t num_entries = entries.size();
+    if (num_entries == 0 || num_variables <= 1) {
+        return;
+    }
+    const size_t num_threads = calculate_num_threads(num_entries, /*min_iterations_per_thread=*/1 << 14);
+    const size_t chunk_size = (num_entries + num_threads - 1) / num_threads;
+    auto chunk_range = [&](size_t thread_idx) {
+        const size_t start = std::min(thread_idx * chunk_size, num_entries);
+        return std::make_pair(start, std::min(start + chunk_size, num_entries));
+    };
+
+    std::vector<CopyCycleEntry> scratch(num_entries);
+    std::vector<std::array<size_t, RADIX>> chunk_offsets(num_threads);
+    const uint64_t max_variable = num_variables - 1;
+    for (size_t shift = 0; (max_variable >> shift) != 0; shift += RADIX_BITS) {
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            auto& counts = chunk_offsets[thread_idx];
+            counts.fill(0);
+            auto [start, end] = chunk_range(thread_idx);
+            for (size_t i = start; i < end; ++i) {
+                counts[(entries[i].real_var_idx >> shift) & (RADIX - 1)]++;
+            }
+        });
+        // Entries with a smaller digit go first, then those with the same digit from an earlier chunk
+        size_t offset = 0;
+        for (size_t digit = 0; digit < RADIX; ++digit) {
+            for (auto& counts : chunk_offsets) {
+                const size_t count = counts[digit];
+                counts[digit] = offset;
+                offset += count;
+            }
+        }
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            auto& offsets = chunk_offsets[thread_idx];
+            auto [start, end] = chunk_range(thread_idx);
+            for (size_t i = start; i < end; ++i) {
+                scratch[offsets[(entries[i].real_var_idx >> shift) & (RADIX - 1)]++] = entries[i];
+            }
+        });
+        std::swap(entries, scratch);
+    }
+}
+
+/**
+ * @brief Group the addresses of the wire values into one copy cycle per variable
+ *
+ * @param entries the addresses of all wire values, in the order of the trace
+ * @param num_variables
+ */
+CopyCycles construct_copy_cycles(std::vector<CopyCycleEntry>& entries, size_t num_variables)
+{
+    sort_by_variable(entries, num_variables);
+
+    CopyCycles copy_cycles;
+    copy_cycles.nodes.resize(entries.size());
+    copy_cycles.offsets.resize(num_variables + 1);
+    parallel_for_heuristic(
+        entries.size(),
+        [&](size_t i) {
+            copy_cycles.nodes[i] = entries[i].node;
+            // The cycle of this entry's variable, and the empty cycles of the variables skipped since the previous
+            // entry, start here
+            const size_t first_var_idx = i == 0 ? 0 : entries[i - 1].real_var_idx + 1;
+            for (size_t var_idx = first_var_idx; var_idx <= entries[i].real_var_idx; ++var_idx) {
+                copy_cycles.offsets[var_idx] = i;
+            }
+        },
+        thread_heuristics::FF_COPY_COST);
+    const size_t first_unused_var_idx = entries.empty() ? 0 : entries.back().real_var_idx + 1;
+    std::fill(copy_cycles.offsets.begin() + static_cast<std::ptrdiff_t>(first_unused_var_idx),
+              copy_cycles.offsets.end(),
+              entries.size());
+    return copy_cycles;
+}
+} // namespace
+
 template <class Flavor>
 void TraceToPolynomials<Flavor>::populate(Builder& builder,
                                           typename Flavor::ProvingKey& proving_key,
@@ -74,49 +168,25 @@ typename TraceToPolynomials<Flavor>::TraceData TraceToPolynomials<Flavor>::const
 
     TraceData trace_data{ builder, proving_key };
 
-    uint32_t offset = Flavor::has_zero_row ? 1 : 0; // Offset at which to place each block in the trace polynomials
-    // For each block in the trace, populate wire polys, copy cycles and selector polys
+    auto blocks = builder.blocks.get();
+    const size_t num_blocks = blocks.size();
 
-    for (auto& block : builder.blocks.get()) {
-        auto block_size = static_cast<uint32_t>(block.size());
+    // The offset at which each block is placed in the trace polynomials, and the number of rows of all blocks before it
+    std::vector<uint32_t> block_offsets(num_blocks);
+    std::vector<size_t> block_row_starts(num_blocks + 1, 0);
+    uint32_t offset = Flavor::has_zero_row ? 1 : 0;
+    for (size_t block_idx = 0; block_idx < num_blocks; ++block_idx) {
+        auto& block = blocks[block_idx];
+        block_offsets[block_idx] = offset;
+        block_row_starts[block_idx + 1] = block_row_starts[block_idx] + block.size();
 
         // Save ranges over which the blocks are "active" for use in structured commitments
         if constexpr (IsUltraFlavor<Flavor>) { // Mega and Ultra
-            PROFILE_THIS_NAME("construct_active_indices");
             if (block.size() > 0) {
                 proving_key.active_region_data.add_range(offset, offset + block.size());
             }
         }
 
-        // Update wire polynomials and copy cycles
-        // NB: The order of row/column loops is arbitrary but needs to be row/column to match old copy_cycle code
-        {
-
-            PROFILE_THIS_NAME("populating wires and copy_cycles");
-
-            for (uint32_t block_row_idx = 0; block_row_idx < block_size; ++block_row_idx) {
-                for (uint32_t wire_idx = 0; wire_idx < NUM_WIRES; ++wire_idx) {
-                    uint32_t var_idx = block.wires[wire_idx][block_row_idx]; // an index into the variables array
-                    uint32_t real_var_idx = builder.real_variable_index[var_idx];
-                    uint32_t trace_row_idx = block_row_idx + offset;
-                    // Insert the real witness values from this block into the wire polys at the correct offset
-                    trace_data.wires[wire_idx].at(trace_row_idx) = builder.get_variable(var_idx);
-                    // Add the address of the witness value to its corresponding copy cycle
-                    trace_data.copy_cycles[real_var_idx].emplace_back(cycle_node{ wire_idx, trace_row_idx });
-                }
-            }
-        }
-
-        // Insert the selector values for this block into the selector polynomials at the correct offset
-        // TODO(https://github.com/AztecProtocol/barretenberg/issues/398): implicit arithmetization/flavor consistency
-        for (size_t selector_idx = 0; selector_idx < NUM_SELECTORS; selector_idx++) {
-            auto& selector = block.selectors[selector_idx];
-            for (size_t row_idx = 0; row_idx < block_size; ++row_idx) {
-                size_t trace_row_idx = row_idx + offset;
-                trace_data.selectors[selector_idx].set_if_valid_index(trace_row_idx, selector[row_idx]);
-            }
-        }
-
         // Store the offset of the block containing RAM/ROM read/write gates for use in updating memory records
         if (block.has_ram_rom) {
             trace_data.ram_rom_offset = offset;
@@ -130,6 +200,68 @@ typename TraceToPolynomials<Flavor>::TraceData TraceToPolynomials<Flavor>::const
         // otherwise, the next block starts immediately following the previous one
         offset += block.get_fixed_size(is_structured);
     }
+    const size_t num_rows = block_row_starts.back();
+
+    // The address of every wire value, at the position of its row among the rows of all blocks
+    std::vector<CopyCycleEntry> copy_cycle_entries(num_rows * NUM_WIRES);
+    {
+
+        PROFILE_THIS_NAME("populating wires, selectors and copy cycle entries");
+
+        parallel_for_heuristic(
+            num_rows,
+            [&](size_t start, size_t end, BB_UNUSED size_t chunk_index) {
+                // The last block starting at or before this chunk
+                auto block_idx = static_cast<size_t>(
+                    std::upper_bound(block_row_starts.begin(), block_row_starts.end(), start) -
+                    block_row_starts.begin() - 1);
+                // Populate the part of each block that lies in this chunk (none for empty blocks)
+                for (size_t segment_start = start; segment_start < end; ++block_idx) {
+                    const size_t segment_end = std::min(block_row_starts[block_idx + 1], end);
+                    auto& block = blocks[block_idx];
+                    const size_t block_start = block_row_starts[block_idx];
+                    const uint32_t block_offset = block_offsets[block_idx];
+
+                    // NB: The order of row/column loops is arbitrary but needs to be row/column to match old
+                    // copy_cycle code
+                    for (size_t row_idx = segment_start; row_idx < segment_end; ++row_idx) {
+                        const size_t block_row_idx = row_idx - block_start;
+                        const auto trace_row_idx = static_cast<uint32_t>(block_row_idx + block_offset);
+                        for (uint32_t wire_idx = 0; wire_idx < NUM_WIRES; ++wire_idx) {
+                            uint32_t var_idx = block.wires[wire_idx][block_row_idx]; // an index into the variables
+                            uint32_t real_var_idx = builder.real_variable_index[var_idx];
+                            // Insert the real witness values from this block into the wire polys at the correct offset
+                            trace_data.wires[wire_idx].at(trace_row_idx) = builder.get_variable(var_idx);
+                            // Record the address of the witness value for its corresponding copy cycle
+                            copy_cycle_entries[row_idx * NUM_WIRES + wire_idx] = {
+                                real_var_idx, cycle_node{ wire_idx, trace_row_idx }
+                            };
+                        }
+                    }
+
+                    // Insert the selector values for this block into the selector polynomials at the correct offset
+                    // TODO(https://github.com/AztecProtocol/barretenberg/issues/398): implicit arithmetization/flavor
+                    // consistency
+                    for (size_t selector_idx = 0; selector_idx < NUM_SELECTORS; selector_idx++) {
+                        auto& selector = trace_data.selectors[selector_idx];
+                        block.selectors[selector_idx].for_each_value(
+                            segment_start - block_start,
+                            segment_end - block_start,
+                            [&](size_t block_row_idx, const FF& value) {
+                                selector.set_if_valid_index(block_row_idx + block_offset, value);
+                            });
+                    }
+                    segment_start = segment_end;
+                }
+            },
+            thread_heuristics::FF_COPY_COST * (2 * NUM_WIRES + NUM_SELECTORS));
+    }
+    {
+
+        PROFILE_THIS_NAME("constructing copy cycles");
+
+        trace_data.copy_cycles = construct_copy_cycles(copy_cycle_entries, builder.variables.size());
+    }
 
     return trace_data;
 }
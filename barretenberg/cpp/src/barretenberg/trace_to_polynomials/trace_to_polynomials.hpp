@@ -21,8 +21,8 @@ template <class Flavor> class TraceToPolynomials {
     struct TraceData {
         std::array<Polynomial, NUM_WIRES> wires;
         std::array<Polynomial, NUM_SELECTORS> selectors;
-        // A vector of sets (vectors) of addresses into the wire polynomials whose values are copy constrained
-        std::vector<CyclicPermutation> copy_cycles;
+        // Sets of addresses into the wire polynomials whose values are copy constrained, one for each variable
+        CopyCycles copy_cycles;
         uint32_t ram_rom_offset = 0;    // offset of the RAM/ROM block in the execution trace
         uint32_t pub_inputs_offset = 0; // offset of the public inputs block in the execution trace
 
@@ -57,11 +57,6 @@ template <class Flavor> class TraceToPolynomials {
                     }
                 }
             }
-            {
-                PROFILE_THIS_NAME("copy cycle initialization");
-
-                copy_cycles.resize(builder.variables.size());
-            }
         }
     };
 
@@ -98,6 +93,10 @@ template <class Flavor> class TraceToPolynomials {
 
     /**
      * @brief Construct wire polynomials, selector polynomials and copy cycles from raw circuit data
+     * @details The blocks occupy disjoint ranges of the trace, so the rows of all blocks are populated in parallel. The
+     * address of each wire value is emitted, tagged with its variable, at the position of its row in the trace, and
+     * the copy cycles are obtained by a stable sort of these addresses by variable. The nodes of each cycle are thus
+     * in the order of the trace, as if the cycles were built by a single pass over the rows.
      *
      * @param builder
      * @param dyadic_circuit_size
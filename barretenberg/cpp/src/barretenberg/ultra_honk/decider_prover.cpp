@@ -1,6 +1,7 @@
 #include "decider_prover.hpp"
 #include "barretenberg/commitment_schemes/small_subgroup_ipa/small_subgroup_ipa.hpp"
 #include "barretenberg/common/op_count.hpp"
+#include "barretenberg/common/stats.hpp"
 #include "barretenberg/sumcheck/sumcheck.hpp"
 
 namespace bb {
@@ -15,9 +16,11 @@ namespace bb {
  * */
 template <IsUltraFlavor Flavor>
 DeciderProver_<Flavor>::DeciderProver_(const std::shared_ptr<DeciderPK>& proving_key,
-                                       const std::shared_ptr<Transcript>& transcript)
+                                       const std::shared_ptr<Transcript>& transcript,
+                                       const ExecutionTraceUsageTracker& trace_usage_tracker)
     : proving_key(std::move(proving_key))
     , transcript(transcript)
+    , trace_usage_tracker(trace_usage_tracker)
 {}
 
 /**
@@ -30,9 +33,14 @@ template <IsUltraFlavor Flavor> void DeciderProver_<Flavor>::execute_relation_ch
     using Sumcheck = SumcheckProver<Flavor>;
     size_t polynomial_size = proving_key->proving_key.circuit_size;
     auto sumcheck = Sumcheck(polynomial_size, transcript);
+    // With a structured trace, only the edges intersecting the active ranges contribute to the round univariates
+    if (trace_usage_tracker.trace_settings.structure && !trace_usage_tracker.active_ranges.empty()) {
+        sumcheck.round.set_active_ranges(trace_usage_tracker.active_ranges);
+    }
     {
 
         PROFILE_THIS_NAME("sumcheck.prove");
+        BB_STATS_PHASE("sumcheck");
 
         if constexpr (Flavor::HasZK) {
             const size_t log_subgroup_size = static_cast<size_t>(numeric::get_msb(Curve::SUBGROUP_SIZE));
@@ -63,6 +71,7 @@ template <IsUltraFlavor Flavor> void DeciderProver_<Flavor>::execute_pcs_rounds(
 {
     using OpeningClaim = ProverOpeningClaim<Curve>;
     using PolynomialBatcher = GeminiProver_<Curve>::PolynomialBatcher;
+    BB_STATS_PHASE("pcs");
 
     auto& ck = proving_key->proving_key.commitment_key;
     ck = ck ? ck : std::make_shared<CommitmentKey>(proving_key->proving_key.circuit_size);
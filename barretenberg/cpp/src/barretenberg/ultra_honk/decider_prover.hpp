@@ -1,6 +1,7 @@
 #pragma once
 #include "barretenberg/commitment_schemes/shplonk/shplemini.hpp"
 #include "barretenberg/honk/proof_system/types/proof.hpp"
+#include "barretenberg/plonk_honk_shared/execution_trace/execution_trace_usage_tracker.hpp"
 #include "barretenberg/relations/relation_parameters.hpp"
 #include "barretenberg/stdlib_circuit_builders/mega_flavor.hpp"
 #include "barretenberg/stdlib_circuit_builders/mega_zk_flavor.hpp"
@@ -30,7 +31,8 @@ template <IsUltraFlavor Flavor> class DeciderProver_ {
 
   public:
     explicit DeciderProver_(const std::shared_ptr<DeciderPK>&,
-                            const std::shared_ptr<Transcript>& transcript = std::make_shared<Transcript>());
+                            const std::shared_ptr<Transcript>& transcript = std::make_shared<Transcript>(),
+                            const ExecutionTraceUsageTracker& trace_usage_tracker = ExecutionTraceUsageTracker{});
 
     BB_PROFILE void execute_relation_check_rounds();
     BB_PROFILE void execute_pcs_rounds();
@@ -42,6 +44,9 @@ template <IsUltraFlavor Flavor> class DeciderProver_ {
 
     std::shared_ptr<Transcript> transcript;
 
+    // Active ranges of the structured trace of the proving key, used to skip the inactive edges in sumcheck
+    ExecutionTraceUsageTracker trace_usage_tracker;
+
     bb::RelationParameters<FF> relation_parameters;
 
     CommitmentLabels commitment_labels;
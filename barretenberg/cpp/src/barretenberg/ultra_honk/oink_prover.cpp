@@ -1,5 +1,6 @@
 #include "barretenberg/ultra_honk/oink_prover.hpp"
 #include "barretenberg/common/op_count.hpp"
+#include "barretenberg/common/stats.hpp"
 #include "barretenberg/plonk_honk_shared/proving_key_inspector.hpp"
 #include "barretenberg/relations/logderiv_lookup_relation.hpp"
 #include "barretenberg/ultra_honk/witness_computation.hpp"
@@ -14,6 +15,7 @@ namespace bb {
  */
 template <IsUltraFlavor Flavor> HonkProof OinkProver<Flavor>::prove()
 {
+    BB_STATS_PHASE("oink");
     if (proving_key->proving_key.commitment_key == nullptr) {
         proving_key->proving_key.commitment_key =
             std::make_shared<CommitmentKey>(proving_key->proving_key.circuit_size);
@@ -102,12 +104,16 @@ template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_wire_commitment
     // We only commit to the fourth wire polynomial after adding memory recordss
     {
         PROFILE_THIS_NAME("COMMIT::wires");
-        auto commit_type = (proving_key->get_is_structured()) ? CommitmentKey::CommitType::Structured
-                                                              : CommitmentKey::CommitType::Default;
-
-        commit_to_witness_polynomial(proving_key->proving_key.polynomials.w_l, commitment_labels.w_l, commit_type);
-        commit_to_witness_polynomial(proving_key->proving_key.polynomials.w_r, commitment_labels.w_r, commit_type);
-        commit_to_witness_polynomial(proving_key->proving_key.polynomials.w_o, commitment_labels.w_o, commit_type);
+        auto& polynomials = proving_key->proving_key.polynomials;
+        if (proving_key->get_is_structured()) {
+            const auto commit_type = CommitmentKey::CommitType::Structured;
+            commit_to_witness_polynomial(polynomials.w_l, commitment_labels.w_l, commit_type);
+            commit_to_witness_polynomial(polynomials.w_r, commitment_labels.w_r, commit_type);
+            commit_to_witness_polynomial(polynomials.w_o, commitment_labels.w_o, commit_type);
+        } else {
+            batch_commit_to_witness_polynomials({ polynomials.w_l, polynomials.w_r, polynomials.w_o },
+                                                { commitment_labels.w_l, commitment_labels.w_r, commitment_labels.w_o });
+        }
     }
 
     if constexpr (IsMegaFlavor<Flavor>) {
@@ -115,13 +121,11 @@ template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_wire_commitment
         // Commit to Goblin ECC op wires.
         // To avoid possible issues with the current work on the merge protocol, they are not
         // masked in MegaZKFlavor
-        for (auto [polynomial, label] :
-             zip_view(proving_key->proving_key.polynomials.get_ecc_op_wires(), commitment_labels.get_ecc_op_wires())) {
-            {
-                PROFILE_THIS_NAME("COMMIT::ecc_op_wires");
-                transcript->send_to_verifier(domain_separator + label,
-                                             proving_key->proving_key.commitment_key->commit(polynomial));
-            };
+        {
+            PROFILE_THIS_NAME("COMMIT::ecc_op_wires");
+            batch_commit_to_witness_polynomials(proving_key->proving_key.polynomials.get_ecc_op_wires(),
+                                                commitment_labels.get_ecc_op_wires(),
+                                                /*mask=*/false);
         }
 
         // Commit to DataBus related polynomials
@@ -263,6 +267,38 @@ void OinkProver<Flavor>::commit_to_witness_polynomial(Polynomial<FF>& polynomial
     transcript->send_to_verifier(domain_separator + label, commitment);
 }
 
+/**
+ * @brief Mask (if required), commit to and send several polynomials that are committed to in the same round, using a
+ * single batched MSM over the shared SRS points.
+ *
+ * @param polynomials
+ * @param labels
+ * @param mask Whether to mask the polynomials when proving in zero-knowledge
+ */
+template <IsUltraFlavor Flavor>
+void OinkProver<Flavor>::batch_commit_to_witness_polynomials(RefVector<Polynomial<FF>> polynomials,
+                                                             RefVector<std::string> labels,
+                                                             bool mask)
+{
+    ASSERT(polynomials.size() == labels.size());
+    std::vector<PolynomialSpan<const FF>> spans;
+    spans.reserve(polynomials.size());
+    for (auto& polynomial : polynomials) {
+        if constexpr (Flavor::HasZK) {
+            if (mask) {
+                polynomial.mask();
+            }
+        }
+        spans.emplace_back(polynomial);
+    }
+
+    auto commitments = proving_key->proving_key.commitment_key->batch_commit(spans);
+    // Send the commitments to the verifier, in order
+    for (auto [commitment, label] : zip_view(commitments, labels)) {
+        transcript->send_to_verifier(domain_separator + label, commitment);
+    }
+}
+
 template class OinkProver<UltraFlavor>;
 template class OinkProver<UltraZKFlavor>;
 template class OinkProver<UltraKeccakFlavor>;
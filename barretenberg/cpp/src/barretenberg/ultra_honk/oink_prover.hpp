@@ -66,6 +66,9 @@ template <IsUltraFlavor Flavor> class OinkProver {
     void commit_to_witness_polynomial(Polynomial<FF>& polynomial,
                                       const std::string& label,
                                       const CommitmentKey::CommitType type = CommitmentKey::CommitType::Default);
+    void batch_commit_to_witness_polynomials(RefVector<Polynomial<FF>> polynomials,
+                                             RefVector<std::string> labels,
+                                             bool mask = true);
 };
 
 using MegaOinkProver = OinkProver<MegaFlavor>;
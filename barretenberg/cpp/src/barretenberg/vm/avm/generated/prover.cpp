@@ -105,6 +105,14 @@ void AvmProver::execute_relation_check_rounds()
     for (size_t idx = 0; idx < gate_challenges.size(); idx++) {
         gate_challenges[idx] = transcript->template get_challenge<FF>("Sumcheck:gate_challenge_" + std::to_string(idx));
     }
+    if (sumcheck_streaming_config.has_value()) {
+        sumcheck_output = sumcheck.prove_streaming(Sumcheck::make_row_chunk_producer(prover_polynomials),
+                                                   relation_parameters,
+                                                   alpha,
+                                                   gate_challenges,
+                                                   *sumcheck_streaming_config);
+        return;
+    }
     sumcheck_output = sumcheck.prove(prover_polynomials, relation_parameters, alpha, gate_challenges);
 }
 
@@ -3,10 +3,13 @@
 
 #include "barretenberg/plonk/proof_system/types/proof.hpp"
 #include "barretenberg/relations/relation_parameters.hpp"
+#include "barretenberg/sumcheck/sumcheck.hpp"
 #include "barretenberg/sumcheck/sumcheck_output.hpp"
 #include "barretenberg/transcript/transcript.hpp"
 #include "flavor.hpp"
 
+#include <optional>
+
 namespace bb::avm {
 
 class AvmProver {
@@ -55,6 +58,10 @@ class AvmProver {
 
     SumcheckOutput<Flavor> sumcheck_output;
 
+    // If set, the first sumcheck rounds stream over the prover polynomials until the book-keeping table fits in the
+    // memory budget, instead of materializing it at half the circuit size (see SumcheckProver::prove_streaming)
+    std::optional<SumcheckStreamingConfig> sumcheck_streaming_config;
+
     std::shared_ptr<PCSCommitmentKey> commitment_key;
 
   protected:
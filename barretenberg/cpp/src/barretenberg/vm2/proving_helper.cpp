@@ -2,6 +2,8 @@
 
 #include <cstdlib>
 #include <memory>
+#include <optional>
+#include <string>
 #include <stdexcept>
 
 #include "barretenberg/common/serialize.hpp"
@@ -34,6 +36,21 @@ std::shared_ptr<AvmProver::ProvingKey> create_proving_key(AvmProver::ProverPolyn
     return proving_key;
 }
 
+// Set with AVM_SUMCHECK_MEMORY_BUDGET_MB, and optionally AVM_SUMCHECK_CHUNK_SIZE (in rows), to bound the memory of the
+// sumcheck book-keeping table
+std::optional<SumcheckStreamingConfig> get_sumcheck_streaming_config()
+{
+    const char* memory_budget_mb = getenv("AVM_SUMCHECK_MEMORY_BUDGET_MB");
+    if (memory_budget_mb == nullptr) {
+        return std::nullopt;
+    }
+    SumcheckStreamingConfig config{ .memory_budget = static_cast<size_t>(std::stoull(memory_budget_mb)) << 20 };
+    if (const char* chunk_size = getenv("AVM_SUMCHECK_CHUNK_SIZE")) {
+        config.chunk_size = static_cast<size_t>(std::stoull(chunk_size));
+    }
+    return config;
+}
+
 } // namespace
 
 std::pair<AvmProvingHelper::Proof, AvmProvingHelper::VkData> AvmProvingHelper::prove(tracegen::TraceContainer&& trace)
@@ -42,6 +59,7 @@ std::pair<AvmProvingHelper::Proof, AvmProvingHelper::VkData> AvmProvingHelper::p
     auto proving_key = AVM_TRACK_TIME_V("proving/prove:proving_key", create_proving_key(polynomials));
     auto prover =
         AVM_TRACK_TIME_V("proving/prove:construct_prover", AvmProver(proving_key, proving_key->commitment_key));
+    prover.sumcheck_streaming_config = get_sumcheck_streaming_config();
     auto verification_key =
         AVM_TRACK_TIME_V("proving/prove:verification_key", std::make_shared<AvmVerifier::VerificationKey>(proving_key));
 
@@ -9,6 +9,7 @@
 #include <cstdint>
 #include <utility>
 #include <variant>
+#include <vector>
 
 namespace bb::world_state {
 
@@ -41,6 +42,13 @@ struct WorldStateRevision {
     static WorldStateRevision uncommitted() { return WorldStateRevision{ .includeUncommitted = true }; }
 };
 
+struct TreeLeafIndices {
+    MerkleTreeId treeId;
+    std::vector<index_t> leafIndices;
+
+    MSGPACK_FIELDS(treeId, leafIndices)
+};
+
 struct WorldStateStatusSummary {
     index_t unfinalisedBlockNumber;
     index_t finalisedBlockNumber;
@@ -177,6 +177,8 @@ Fork::SharedPtr WorldState::retrieve_fork(const uint64_t& forkId) const
 }
 uint64_t WorldState::create_fork(const std::optional<index_t>& blockNumber)
 {
+    // Forks read the stores directly, so need the last committed block to have been written
+    wait_for_persisted_commit();
     block_number_t blockNumberForFork = 0;
     if (!blockNumber.has_value()) {
         // we are forking at latest
@@ -442,6 +444,61 @@ fr_sibling_path WorldState::get_sibling_path(const WorldStateRevision& revision,
         fork->_trees.at(tree_id));
 }
 
+GetSiblingPathsResponse WorldState::get_sibling_paths(const WorldStateRevision& revision,
+                                                     MerkleTreeId tree_id,
+                                                     const std::vector<index_t>& leaf_indices) const
+{
+    std::vector<GetSiblingPathsResponse> responses =
+        get_sibling_paths(revision, { TreeLeafIndices{ .treeId = tree_id, .leafIndices = leaf_indices } });
+    return std::move(responses[0]);
+}
+
+std::vector<GetSiblingPathsResponse> WorldState::get_sibling_paths(const WorldStateRevision& revision,
+                                                                   const std::vector<TreeLeafIndices>& queries) const
+{
+    Fork::SharedPtr fork = retrieve_fork(revision.forkId);
+    // Checked upfront, as the queries in flight reference this stack frame
+    for (const auto& query : queries) {
+        if (fork->_trees.find(query.treeId) == fork->_trees.end()) {
+            throw std::runtime_error(
+                format("Unable to get sibling paths, unknown tree ", static_cast<uint64_t>(query.treeId)));
+        }
+    }
+
+    // Each tree answers its queries from its own thread pool, so all of them can be in flight at once
+    Signal signal(static_cast<uint32_t>(queries.size()));
+    std::vector<TypedResponse<GetSiblingPathsResponse>> local(queries.size());
+
+    for (size_t i = 0; i < queries.size(); ++i) {
+        auto callback = [&signal, &local, i](TypedResponse<GetSiblingPathsResponse>& response) {
+            local[i] = std::move(response);
+            signal.signal_decrement();
+        };
+        std::visit(
+            [&callback, &revision, &query = queries[i]](auto&& wrapper) {
+                if (revision.blockNumber) {
+                    wrapper.tree->get_sibling_paths(
+                        query.leafIndices, revision.blockNumber, callback, revision.includeUncommitted);
+                } else {
+                    wrapper.tree->get_sibling_paths(query.leafIndices, callback, revision.includeUncommitted);
+                }
+            },
+            fork->_trees.at(queries[i].treeId));
+    }
+
+    signal.wait_for_level(0);
+
+    std::vector<GetSiblingPathsResponse> responses;
+    responses.reserve(queries.size());
+    for (auto& response : local) {
+        if (!response.success) {
+            throw std::runtime_error(response.message);
+        }
+        responses.push_back(std::move(response.inner));
+    }
+    return responses;
+}
+
 void WorldState::get_block_numbers_for_leaf_indices(const WorldStateRevision& revision,
                                                     MerkleTreeId tree_id,
                                                     const std::vector<index_t>& leafIndices,
@@ -503,46 +560,161 @@ void WorldState::update_archive(const StateReference& block_state_ref,
 std::pair<bool, std::string> WorldState::commit(WorldStateStatusFull& status)
 {
     // NOTE: the calling code is expected to ensure no other reads or writes happen during commit
+    std::pair<bool, std::string> result = begin_commit(status);
+    std::pair<bool, std::string> persisted = finish_commit(status.dbStats);
+    return result.first ? persisted : result;
+}
+
+void WorldState::wait_for_persisted_commit()
+{
+    WorldStateDBStats dbStats;
+    std::pair<bool, std::string> result = finish_commit(dbStats);
+    if (!result.first) {
+        throw std::runtime_error(result.second);
+    }
+}
+
+std::pair<bool, std::string> WorldState::begin_commit(WorldStateStatusFull& status)
+{
+    // Only one block is written at a time
+    std::pair<bool, std::string> previous = finish_commit(status.dbStats);
+    if (!previous.first) {
+        return previous;
+    }
+
     Fork::SharedPtr fork = retrieve_fork(CANONICAL_FORK_ID);
     std::atomic_bool success = true;
     std::string message;
     Signal signal(static_cast<uint32_t>(fork->_trees.size()));
+    auto pending = std::make_shared<PendingCommit>();
 
     {
         auto& wrapper = std::get<TreeWithStore<NullifierTree>>(fork->_trees.at(MerkleTreeId::NULLIFIER_TREE));
-        commit_tree(
-            status.dbStats.nullifierTreeStats, signal, *wrapper.tree, success, message, status.meta.nullifierTreeMeta);
+        commit_tree(MerkleTreeId::NULLIFIER_TREE,
+                    pending->dbStats.nullifierTreeStats,
+                    signal,
+                    *wrapper.tree,
+                    success,
+                    message,
+                    status.meta.nullifierTreeMeta,
+                    pending);
     }
     {
         auto& wrapper = std::get<TreeWithStore<PublicDataTree>>(fork->_trees.at(MerkleTreeId::PUBLIC_DATA_TREE));
-        commit_tree(status.dbStats.publicDataTreeStats,
+        commit_tree(MerkleTreeId::PUBLIC_DATA_TREE,
+                    pending->dbStats.publicDataTreeStats,
                     signal,
                     *wrapper.tree,
                     success,
                     message,
-                    status.meta.publicDataTreeMeta);
+                    status.meta.publicDataTreeMeta,
+                    pending);
     }
 
     {
         auto& wrapper = std::get<TreeWithStore<FrTree>>(fork->_trees.at(MerkleTreeId::NOTE_HASH_TREE));
-        commit_tree(
-            status.dbStats.noteHashTreeStats, signal, *wrapper.tree, success, message, status.meta.noteHashTreeMeta);
+        commit_tree(MerkleTreeId::NOTE_HASH_TREE,
+                    pending->dbStats.noteHashTreeStats,
+                    signal,
+                    *wrapper.tree,
+                    success,
+                    message,
+                    status.meta.noteHashTreeMeta,
+                    pending);
     }
 
     {
         auto& wrapper = std::get<TreeWithStore<FrTree>>(fork->_trees.at(MerkleTreeId::L1_TO_L2_MESSAGE_TREE));
-        commit_tree(
-            status.dbStats.messageTreeStats, signal, *wrapper.tree, success, message, status.meta.messageTreeMeta);
+        commit_tree(MerkleTreeId::L1_TO_L2_MESSAGE_TREE,
+                    pending->dbStats.messageTreeStats,
+                    signal,
+                    *wrapper.tree,
+                    success,
+                    message,
+                    status.meta.messageTreeMeta,
+                    pending);
     }
 
     {
         auto& wrapper = std::get<TreeWithStore<FrTree>>(fork->_trees.at(MerkleTreeId::ARCHIVE));
-        commit_tree(
-            status.dbStats.archiveTreeStats, signal, *wrapper.tree, success, message, status.meta.archiveTreeMeta);
+        commit_tree(MerkleTreeId::ARCHIVE,
+                    pending->dbStats.archiveTreeStats,
+                    signal,
+                    *wrapper.tree,
+                    success,
+                    message,
+                    status.meta.archiveTreeMeta,
+                    pending);
     }
 
     signal.wait_for_level(0);
-    return std::make_pair(success.load(), message);
+    {
+        std::unique_lock lock(_commitMtx);
+        _pendingCommit = pending;
+    }
+    if (!success) {
+        // The trees that did commit the block are writing it, wait for that to unwind it
+        WorldStateDBStats dbStats;
+        std::pair<bool, std::string> reverted = finish_commit(dbStats);
+        return std::make_pair(false, reverted.first ? message : reverted.second);
+    }
+    return std::make_pair(true, message);
+}
+
+std::pair<bool, std::string> WorldState::finish_commit(WorldStateDBStats& dbStats)
+{
+    std::shared_ptr<PendingCommit> pending;
+    {
+        std::unique_lock lock(_commitMtx);
+        pending = _pendingCommit;
+    }
+    if (pending) {
+        pending->signal.wait_for_level(0);
+    }
+    std::unique_lock lock(_commitMtx);
+    if (pending && _pendingCommit == pending) {
+        _pendingCommit.reset();
+        if (pending->success) {
+            _persistedDbStats = pending->dbStats;
+        } else {
+            revert_failed_commit(*pending);
+        }
+    }
+    dbStats = _persistedDbStats;
+    return pending ? std::make_pair(pending->success.load(), pending->message) : std::make_pair(true, std::string());
+}
+
+void WorldState::revert_failed_commit(PendingCommit& pending)
+{
+    // Drops the uncommitted state of every tree, and the block of the trees that could not write it
+    rollback();
+
+    Fork::SharedPtr fork = retrieve_fork(CANONICAL_FORK_ID);
+    std::string unwindErrors;
+    for (auto& [id, tree] : fork->_trees) {
+        std::optional<block_number_t> blockNumber = pending.persistedBlocks[id];
+        if (!blockNumber.has_value()) {
+            continue;
+        }
+        std::visit(
+            [&](auto&& wrapper) {
+                Signal signal;
+                TypedResponse<UnwindResponse> local;
+                wrapper.tree->unwind_block(blockNumber.value(), [&](TypedResponse<UnwindResponse>& response) {
+                    local = std::move(response);
+                    signal.signal_level();
+                });
+                signal.wait_for_level();
+                if (!local.success) {
+                    unwindErrors += format(" Unable to unwind tree ", getMerkleTreeName(id), ": ", local.message);
+                }
+            },
+            tree);
+    }
+    pending.message = format("Failed to write the block to all trees, it was rolled back: ", pending.message);
+    if (!unwindErrors.empty()) {
+        pending.message += unwindErrors;
+    }
 }
 
 void WorldState::rollback()
@@ -565,17 +737,24 @@ WorldStateStatusFull WorldState::sync_block(const StateReference& block_state_re
                                             const std::vector<bb::fr>& notes,
                                             const std::vector<bb::fr>& l1_to_l2_messages,
                                             const std::vector<crypto::merkle_tree::NullifierLeafValue>& nullifiers,
-                                            const std::vector<crypto::merkle_tree::PublicDataLeafValue>& public_writes)
+                                            const std::vector<crypto::merkle_tree::PublicDataLeafValue>& public_writes,
+                                            bool waitForPersisted)
 {
     validate_trees_are_equally_synched();
     WorldStateStatusFull status;
-    if (is_same_state_reference(WorldStateRevision::uncommitted(), block_state_ref) &&
-        is_archive_tip(WorldStateRevision::uncommitted(), block_header_hash)) {
-        std::pair<bool, std::string> result = commit(status);
+    auto commit = [&]() {
+        std::pair<bool, std::string> result = begin_commit(status);
+        if (result.first && waitForPersisted) {
+            result = finish_commit(status.dbStats);
+        }
         if (!result.first) {
             throw std::runtime_error(result.second);
         }
         populate_status_summary(status);
+    };
+    if (is_same_state_reference(WorldStateRevision::uncommitted(), block_state_ref) &&
+        is_archive_tip(WorldStateRevision::uncommitted(), block_header_hash)) {
+        commit();
         return status;
     }
     rollback();
@@ -651,11 +830,7 @@ WorldStateStatusFull WorldState::sync_block(const StateReference& block_state_re
         throw std::runtime_error("Can't synch block: block state does not match world state");
     }
 
-    std::pair<bool, std::string> result = commit(status);
-    if (!result.first) {
-        throw std::runtime_error(result.second);
-    }
-    populate_status_summary(status);
+    commit();
     return status;
 }
 
@@ -699,6 +874,7 @@ GetLowIndexedLeafResponse WorldState::find_low_leaf_index(const WorldStateRevisi
 
 WorldStateStatusSummary WorldState::set_finalised_blocks(const index_t& toBlockNumber)
 {
+    wait_for_persisted_commit();
     WorldStateRevision revision{ .forkId = CANONICAL_FORK_ID, .blockNumber = 0, .includeUncommitted = false };
     TreeMetaResponse archive_state = get_tree_info(revision, MerkleTreeId::ARCHIVE);
     if (toBlockNumber <= archive_state.meta.finalisedBlockHeight) {
@@ -715,6 +891,7 @@ WorldStateStatusSummary WorldState::set_finalised_blocks(const index_t& toBlockN
 }
 WorldStateStatusFull WorldState::unwind_blocks(const index_t& toBlockNumber)
 {
+    wait_for_persisted_commit();
     WorldStateRevision revision{ .forkId = CANONICAL_FORK_ID, .blockNumber = 0, .includeUncommitted = false };
     TreeMetaResponse archive_state = get_tree_info(revision, MerkleTreeId::ARCHIVE);
     if (toBlockNumber >= archive_state.meta.unfinalisedBlockHeight) {
@@ -731,6 +908,7 @@ WorldStateStatusFull WorldState::unwind_blocks(const index_t& toBlockNumber)
 }
 WorldStateStatusFull WorldState::remove_historical_blocks(const index_t& toBlockNumber)
 {
+    wait_for_persisted_commit();
     WorldStateRevision revision{ .forkId = CANONICAL_FORK_ID, .blockNumber = 0, .includeUncommitted = false };
     TreeMetaResponse archive_state = get_tree_info(revision, MerkleTreeId::ARCHIVE);
     if (toBlockNumber <= archive_state.meta.oldestHistoricBlock) {
@@ -19,12 +19,16 @@
 #include "barretenberg/world_state/types.hpp"
 #include "barretenberg/world_state/world_state_stores.hpp"
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <cstdint>
 #include <exception>
 #include <iterator>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <stdexcept>
+#include <string>
 #include <type_traits>
 #include <unordered_map>
 #include <variant>
@@ -124,6 +128,29 @@ class WorldState {
                                                           MerkleTreeId tree_id,
                                                           index_t leaf_index) const;
 
+    /**
+     * @brief Gets the sibling paths and leaf hashes of many leaves in a tree
+     *
+     * @param revision The revision to query
+     * @param tree_id The ID of the tree
+     * @param leaf_indices The indices of the leaves
+     * @return crypto::merkle_tree::GetSiblingPathsResponse The paths and leaf hashes in the order of leaf_indices
+     */
+    crypto::merkle_tree::GetSiblingPathsResponse get_sibling_paths(const WorldStateRevision& revision,
+                                                                   MerkleTreeId tree_id,
+                                                                   const std::vector<index_t>& leaf_indices) const;
+
+    /**
+     * @brief Gets the sibling paths and leaf hashes of many leaves across several trees. The trees are queried
+     * concurrently, each from a single read transaction that reads the nodes shared by its paths once.
+     *
+     * @param revision The revision to query
+     * @param queries The leaf indices to query in each tree
+     * @return std::vector<crypto::merkle_tree::GetSiblingPathsResponse> A response for each query
+     */
+    std::vector<crypto::merkle_tree::GetSiblingPathsResponse> get_sibling_paths(
+        const WorldStateRevision& revision, const std::vector<TreeLeafIndices>& queries) const;
+
     void get_block_numbers_for_leaf_indices(const WorldStateRevision& revision,
                                             MerkleTreeId tree_id,
                                             const std::vector<index_t>& leafIndices,
@@ -245,6 +272,15 @@ class WorldState {
      */
     std::pair<bool, std::string> commit(WorldStateStatusFull& status);
 
+    /**
+     * @brief Waits for the last block committed by sync_block to be written to the stores of all the trees
+     * @details A block synched without waiting for it to be written is the committed state of the trees, and is
+     * written to their stores in the background while the next block is synched. The block is written to all the
+     * trees or to none: if a tree could not write it, the trees that did are unwound, every tree is rolled back to the
+     * previous block and this throws.
+     */
+    void wait_for_persisted_commit();
+
     /**
      * @brief Rolls back any uncommitted changes made to the world state.
      */
@@ -258,12 +294,21 @@ class WorldState {
     WorldStateStatusFull remove_historical_blocks(const index_t& toBlockNumber);
 
     void get_status_summary(WorldStateStatusSummary& status) const;
+
+    /**
+     * @brief Synchs the world state with a block and commits it
+     * @details Returns once the block is written to the stores of all the trees, unless waitForPersisted is false: it
+     * then returns as soon as the block is the committed state of the trees, and the block is only durable once
+     * wait_for_persisted_commit returns. The database stats of the returned status are then those of the stores as of
+     * the previous block.
+     */
     WorldStateStatusFull sync_block(const StateReference& block_state_ref,
                                     const bb::fr& block_header_hash,
                                     const std::vector<bb::fr>& notes,
                                     const std::vector<bb::fr>& l1_to_l2_messages,
                                     const std::vector<crypto::merkle_tree::NullifierLeafValue>& nullifiers,
-                                    const std::vector<crypto::merkle_tree::PublicDataLeafValue>& public_writes);
+                                    const std::vector<crypto::merkle_tree::PublicDataLeafValue>& public_writes,
+                                    bool waitForPersisted = true);
 
     void checkpoint(const uint64_t& forkId);
     void commit_checkpoint(const uint64_t& forkId);
@@ -280,6 +325,20 @@ class WorldState {
     uint64_t _forkId = 0;
     uint32_t _initial_header_generator_point;
 
+    // The last block committed by sync_block, while the trees are being written to their stores
+    struct PendingCommit {
+        Signal signal{ static_cast<uint32_t>(NUM_TREES) };
+        std::atomic_bool success = true;
+        std::string message;
+        WorldStateDBStats dbStats;
+        // The block each tree wrote to its store, if it did
+        std::array<std::optional<block_number_t>, NUM_TREES> persistedBlocks;
+    };
+    std::shared_ptr<PendingCommit> _pendingCommit;
+    // The database stats as of the last block written to the stores
+    WorldStateDBStats _persistedDbStats;
+    std::mutex _commitMtx;
+
     TreeStateReference get_tree_snapshot(MerkleTreeId id);
     void create_canonical_fork(const std::string& dataDir,
                                const std::unordered_map<MerkleTreeId, uint64_t>& dbSize,
@@ -317,13 +376,22 @@ class WorldState {
 
     static void populate_status_summary(WorldStateStatusFull& status);
 
+    // Commits the trees, returning once the block is their committed state while they are written to their stores
+    std::pair<bool, std::string> begin_commit(WorldStateStatusFull& status);
+    // Waits for the trees committed by begin_commit to be written, returns the stats of the stores
+    std::pair<bool, std::string> finish_commit(WorldStateDBStats& dbStats);
+    // Returns all the trees to the block before a commit that not all of them could write
+    void revert_failed_commit(PendingCommit& pending);
+
     template <typename TreeType>
-    void commit_tree(TreeDBStats& dbStats,
+    void commit_tree(MerkleTreeId id,
+                     TreeDBStats& dbStats,
                      Signal& signal,
                      TreeType& tree,
                      std::atomic_bool& success,
                      std::string& message,
-                     TreeMeta& meta);
+                     TreeMeta& meta,
+                     const std::shared_ptr<PendingCommit>& pending);
 
     template <typename TreeType>
     void unwind_tree(TreeDBStats& dbStats,
@@ -345,22 +413,36 @@ class WorldState {
 };
 
 template <typename TreeType>
-void WorldState::commit_tree(TreeDBStats& dbStats,
+void WorldState::commit_tree(MerkleTreeId id,
+                             TreeDBStats& dbStats,
                              Signal& signal,
                              TreeType& tree,
                              std::atomic_bool& success,
                              std::string& message,
-                             TreeMeta& meta)
+                             TreeMeta& meta,
+                             const std::shared_ptr<PendingCommit>& pending)
 {
-    tree.commit([&](TypedResponse<CommitResponse>& response) {
-        bool expected = true;
-        if (!response.success && success.compare_exchange_strong(expected, false)) {
-            message = response.message;
-        }
-        dbStats = std::move(response.inner.stats);
-        meta = std::move(response.inner.meta);
-        signal.signal_decrement();
-    });
+    tree.commit_async(
+        [&](TypedResponse<CommitResponse>& response) {
+            bool expected = true;
+            if (!response.success && success.compare_exchange_strong(expected, false)) {
+                message = response.message;
+            }
+            meta = std::move(response.inner.meta);
+            signal.signal_decrement();
+        },
+        // dbStats is a member of the pending commit, kept alive by this callback
+        [pending, id, &dbStats](TypedResponse<CommitResponse>& response) {
+            bool expected = true;
+            if (!response.success && pending->success.compare_exchange_strong(expected, false)) {
+                pending->message = response.message;
+            }
+            if (response.success) {
+                pending->persistedBlocks[id] = response.inner.meta.unfinalisedBlockHeight;
+            }
+            dbStats = std::move(response.inner.stats);
+            pending->signal.signal_decrement();
+        });
 }
 
 template <typename TreeType>
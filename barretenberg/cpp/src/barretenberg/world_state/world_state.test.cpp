@@ -15,6 +15,7 @@
 #include <stdexcept>
 #include <sys/types.h>
 #include <unordered_map>
+#include <vector>
 
 using namespace bb::world_state;
 using namespace bb::crypto::merkle_tree;
@@ -400,6 +401,48 @@ TEST_F(WorldStateTest, AppendOnlyTrees)
     }
 }
 
+TEST_F(WorldStateTest, GetSiblingPathsAcrossTrees)
+{
+    WorldState ws(thread_pool_size, data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
+
+    ws.append_leaves<fr>(MerkleTreeId::NOTE_HASH_TREE, { fr(42), fr(43), fr(44) });
+    ws.batch_insert_indexed_leaves<NullifierLeafValue>(
+        MerkleTreeId::NULLIFIER_TREE, { NullifierLeafValue(150), NullifierLeafValue(142) }, 1);
+
+    std::vector<TreeLeafIndices> queries{
+        { .treeId = MerkleTreeId::NOTE_HASH_TREE, .leafIndices = { 2, 0, 1, 0 } },
+        { .treeId = MerkleTreeId::NULLIFIER_TREE, .leafIndices = { 129, 3, 128, 127 } },
+        { .treeId = MerkleTreeId::ARCHIVE, .leafIndices = { 0 } },
+    };
+
+    // The appended leaves are beyond the end of the committed trees
+    EXPECT_THROW(ws.get_sibling_paths(WorldStateRevision::committed(), queries), std::runtime_error);
+    std::vector<TreeLeafIndices> out_of_range{ { .treeId = MerkleTreeId::ARCHIVE, .leafIndices = { 0, 1 } } };
+    EXPECT_THROW(ws.get_sibling_paths(WorldStateRevision::uncommitted(), out_of_range), std::runtime_error);
+
+    WorldStateStatusFull status;
+    ws.commit(status);
+    for (auto revision : { WorldStateRevision::committed(), WorldStateRevision::uncommitted() }) {
+        std::vector<GetSiblingPathsResponse> responses = ws.get_sibling_paths(revision, queries);
+        ASSERT_EQ(responses.size(), queries.size());
+        for (size_t i = 0; i < queries.size(); ++i) {
+            const auto& indices = queries[i].leafIndices;
+            ASSERT_EQ(responses[i].paths.size(), indices.size());
+            ASSERT_EQ(responses[i].leaves.size(), indices.size());
+            for (size_t j = 0; j < indices.size(); ++j) {
+                EXPECT_EQ(responses[i].paths[j], ws.get_sibling_path(revision, queries[i].treeId, indices[j]));
+            }
+        }
+
+        // The leaves of append only trees are their values
+        const auto& note_hash_leaves = responses[0].leaves;
+        for (size_t j = 0; j < queries[0].leafIndices.size(); ++j) {
+            EXPECT_EQ(note_hash_leaves[j],
+                      ws.get_leaf<fr>(revision, MerkleTreeId::NOTE_HASH_TREE, queries[0].leafIndices[j]));
+        }
+    }
+}
+
 TEST_F(WorldStateTest, AppendOnlyAllowDuplicates)
 {
     WorldState ws(thread_pool_size, data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
@@ -890,6 +933,104 @@ TEST_F(WorldStateTest, BuildsABlockInAFork)
     EXPECT_EQ(fork_state_ref, ws.get_state_reference(WorldStateRevision::committed()));
 }
 
+TEST_F(WorldStateTest, ReadsASyncedBlockWhileItIsPersisted)
+{
+    StateReference block_state_ref;
+    {
+        WorldState ws(thread_pool_size, data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
+        auto fork_id = ws.create_fork(0);
+        ws.append_leaves<bb::fr>(MerkleTreeId::NOTE_HASH_TREE, { 42 }, fork_id);
+        ws.append_leaves<bb::fr>(MerkleTreeId::L1_TO_L2_MESSAGE_TREE, { 43 }, fork_id);
+        ws.batch_insert_indexed_leaves<NullifierLeafValue>(MerkleTreeId::NULLIFIER_TREE, { { 129 } }, 0, fork_id);
+        ws.batch_insert_indexed_leaves<PublicDataLeafValue>(
+            MerkleTreeId::PUBLIC_DATA_TREE, { { 129, 1 } }, 0, fork_id);
+        block_state_ref = ws.get_state_reference(WorldStateRevision{ .forkId = fork_id, .includeUncommitted = true });
+        ws.delete_fork(fork_id);
+
+        ws.sync_block(block_state_ref, { 1 }, { 42 }, { 43 }, { { 129 } }, { { { 129, 1 } } }, false);
+
+        // Build the next block straight away, on top of the block being written
+        ws.append_leaves<bb::fr>(MerkleTreeId::NOTE_HASH_TREE, { 44 });
+        ws.batch_insert_indexed_leaves<NullifierLeafValue>(MerkleTreeId::NULLIFIER_TREE, { { 130 } }, 0);
+
+        EXPECT_EQ(ws.get_state_reference(WorldStateRevision::committed()), block_state_ref);
+        assert_leaf_value(ws, WorldStateRevision::committed(), MerkleTreeId::NOTE_HASH_TREE, 0, fr(42));
+        assert_leaf_index(ws, WorldStateRevision::committed(), MerkleTreeId::NOTE_HASH_TREE, fr(42), 0);
+        assert_leaf_exists(ws, WorldStateRevision::committed(), MerkleTreeId::NOTE_HASH_TREE, fr(44), false);
+        assert_leaf_value(
+            ws, WorldStateRevision::committed(), MerkleTreeId::NULLIFIER_TREE, 128, NullifierLeafValue(129));
+        assert_leaf_value(
+            ws, WorldStateRevision::uncommitted(), MerkleTreeId::NULLIFIER_TREE, 129, NullifierLeafValue(130));
+        WorldStateRevision block_1{ .forkId = CANONICAL_FORK_ID, .blockNumber = 1, .includeUncommitted = false };
+        assert_tree_size(ws, block_1, MerkleTreeId::NOTE_HASH_TREE, 1);
+
+        auto low_leaf = ws.find_low_leaf_index(WorldStateRevision::committed(), MerkleTreeId::NULLIFIER_TREE, 131);
+        EXPECT_EQ(low_leaf, GetLowIndexedLeafResponse(false, 128UL));
+
+        std::vector<std::optional<block_number_t>> blockNumbers;
+        ws.get_block_numbers_for_leaf_indices(
+            WorldStateRevision::committed(), MerkleTreeId::NOTE_HASH_TREE, { 0 }, blockNumbers);
+        EXPECT_EQ(blockNumbers[0], 1);
+
+        // Forks read the stores, so wait for the block to be written
+        auto latest_fork_id = ws.create_fork(std::nullopt);
+        EXPECT_EQ(ws.get_state_reference(WorldStateRevision{ .forkId = latest_fork_id }), block_state_ref);
+        ws.delete_fork(latest_fork_id);
+
+        ws.wait_for_persisted_commit();
+    }
+
+    WorldState ws(thread_pool_size, data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
+    EXPECT_EQ(ws.get_state_reference(WorldStateRevision::committed()), block_state_ref);
+    assert_leaf_value(ws, WorldStateRevision::committed(), MerkleTreeId::NOTE_HASH_TREE, 0, fr(42));
+    assert_leaf_exists(ws, WorldStateRevision::uncommitted(), MerkleTreeId::NOTE_HASH_TREE, fr(44), false);
+}
+
+TEST_F(WorldStateTest, RollsBackABlockNotAllTreesCouldWrite)
+{
+    // The note hash tree does not have the room for the block, the other trees do
+    std::unordered_map<MerkleTreeId, uint64_t> map_sizes{
+        { MerkleTreeId::NULLIFIER_TREE, map_size },   { MerkleTreeId::NOTE_HASH_TREE, 1024 },
+        { MerkleTreeId::PUBLIC_DATA_TREE, map_size }, { MerkleTreeId::L1_TO_L2_MESSAGE_TREE, map_size },
+        { MerkleTreeId::ARCHIVE, map_size },
+    };
+    WorldState ws(thread_pool_size, data_dir, map_sizes, tree_heights, tree_prefill, initial_header_generator_point);
+    StateReference initial_state_ref = ws.get_state_reference(WorldStateRevision::committed());
+
+    std::vector<fr> notes;
+    for (uint64_t i = 1; i <= 8192; ++i) {
+        notes.emplace_back(i);
+    }
+    ws.append_leaves<fr>(MerkleTreeId::NOTE_HASH_TREE, notes);
+    ws.append_leaves<fr>(MerkleTreeId::L1_TO_L2_MESSAGE_TREE, { fr(42) });
+    ws.append_leaves<fr>(MerkleTreeId::ARCHIVE, { fr(42) });
+    ws.append_leaves<NullifierLeafValue>(MerkleTreeId::NULLIFIER_TREE, { NullifierLeafValue(142) });
+    ws.append_leaves<PublicDataLeafValue>(MerkleTreeId::PUBLIC_DATA_TREE, { PublicDataLeafValue(142, 1) });
+
+    WorldStateStatusFull status;
+    EXPECT_FALSE(ws.commit(status).first);
+
+    // None of the trees has the block, in memory or in its store
+    EXPECT_EQ(ws.get_state_reference(WorldStateRevision::committed()), initial_state_ref);
+    EXPECT_EQ(ws.get_state_reference(WorldStateRevision::uncommitted()), initial_state_ref);
+    WorldStateStatusSummary summary;
+    ws.get_status_summary(summary);
+    EXPECT_EQ(summary.unfinalisedBlockNumber, 0);
+    EXPECT_TRUE(summary.treesAreSynched);
+    assert_leaf_exists(ws, WorldStateRevision::committed(), MerkleTreeId::ARCHIVE, fr(42), false);
+    assert_leaf_exists(
+        ws, WorldStateRevision::committed(), MerkleTreeId::NULLIFIER_TREE, NullifierLeafValue(142), false);
+
+    // A block that fits is then written to all the trees
+    ws.append_leaves<fr>(MerkleTreeId::NOTE_HASH_TREE, { fr(43) });
+    ws.append_leaves<fr>(MerkleTreeId::ARCHIVE, { fr(43) });
+    EXPECT_TRUE(ws.commit(status).first);
+    ws.get_status_summary(summary);
+    EXPECT_EQ(summary.unfinalisedBlockNumber, 1);
+    EXPECT_TRUE(summary.treesAreSynched);
+    assert_leaf_value(ws, WorldStateRevision::committed(), MerkleTreeId::NOTE_HASH_TREE, 0, fr(43));
+}
+
 TEST_F(WorldStateTest, GetBlockForIndex)
 {
     WorldState ws(thread_pool_size, data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
@@ -41,6 +41,12 @@ export enum WorldStateMessageType {
   COMMIT_CHECKPOINT,
   REVERT_CHECKPOINT,
 
+  GET_SIBLING_PATHS,
+
+  GET_STATS,
+
+  WAIT_FOR_PERSISTED,
+
   CLOSE = 999,
 }
 
@@ -326,6 +332,25 @@ interface GetBlockNumbersForLeafIndicesResponse {
 interface GetSiblingPathRequest extends WithTreeId, WithLeafIndex, WithWorldStateRevision {}
 type GetSiblingPathResponse = Buffer[];
 
+interface GetSiblingPathsRequest extends WithWorldStateRevision {
+  queries: { treeId: MerkleTreeId; leafIndices: bigint[] }[];
+}
+
+interface GetSiblingPathsResponse {
+  /** The sibling paths and leaf hashes of each query, in the order of the queries */
+  trees: { paths: Buffer[][]; leaves: (Buffer | undefined)[] }[];
+}
+
+interface GetStatsRequest extends WithCanonicalForkId {
+  /** Whether to zero the statistics once read */
+  reset: boolean;
+}
+
+interface GetStatsResponse {
+  /** JSON encoded peak memory usage, thread count, and count and wall time of each message type (keyed by name) */
+  stats: string;
+}
+
 interface GetStateReferenceRequest extends WithWorldStateRevision {}
 interface GetStateReferenceResponse {
   state: Record<MerkleTreeId, TreeStateReference>;
@@ -396,6 +421,8 @@ interface SyncBlockRequest extends WithCanonicalForkId {
   paddedL1ToL2Messages: readonly SerializedLeafValue[];
   paddedNullifiers: readonly SerializedLeafValue[];
   publicDataWrites: readonly SerializedLeafValue[];
+  /** Whether to respond once the block is written to disk, rather than once it is committed in memory */
+  waitForPersisted: boolean;
 }
 
 interface CreateForkRequest extends WithCanonicalForkId {
@@ -460,6 +487,12 @@ export type WorldStateRequest = {
   [WorldStateMessageType.COMMIT_CHECKPOINT]: WithForkId;
   [WorldStateMessageType.REVERT_CHECKPOINT]: WithForkId;
 
+  [WorldStateMessageType.GET_SIBLING_PATHS]: GetSiblingPathsRequest;
+
+  [WorldStateMessageType.GET_STATS]: GetStatsRequest;
+
+  [WorldStateMessageType.WAIT_FOR_PERSISTED]: WithCanonicalForkId;
+
   [WorldStateMessageType.CLOSE]: WithCanonicalForkId;
 };
 
@@ -500,6 +533,12 @@ export type WorldStateResponse = {
   [WorldStateMessageType.COMMIT_CHECKPOINT]: void;
   [WorldStateMessageType.REVERT_CHECKPOINT]: void;
 
+  [WorldStateMessageType.GET_SIBLING_PATHS]: GetSiblingPathsResponse;
+
+  [WorldStateMessageType.GET_STATS]: GetStatsResponse;
+
+  [WorldStateMessageType.WAIT_FOR_PERSISTED]: void;
+
   [WorldStateMessageType.CLOSE]: void;
 };
 
@@ -126,7 +126,30 @@ describe('NativeWorldState', () => {
       await ws.close();
     });
 
-    it('Fails to sync further blocks if trees are out of sync', async () => {
+    it('persists blocks synched without waiting for them to be written', async () => {
+      const asyncDataDir = await mkdtemp(join(tmpdir(), 'world-state-test'));
+      let ws = await NativeWorldStateService.new(rollupAddress, asyncDataDir, defaultDBMapSize);
+      for (let blockNumber = 1; blockNumber <= 3; blockNumber++) {
+        const fork = await ws.fork();
+        const { block, messages } = await mockBlock(blockNumber, 2, fork);
+        await fork.close();
+        const status = await ws.handleL2BlockAndMessages(block, messages, false);
+        expect(status.summary.unfinalisedBlockNumber).toBe(BigInt(blockNumber));
+        if (blockNumber === 2) {
+          await ws.waitForPersisted();
+        }
+      }
+      // The last block is still being written, closing waits for it
+      await ws.close();
+
+      ws = await NativeWorldStateService.new(rollupAddress, asyncDataDir, defaultDBMapSize);
+      const status = await ws.getStatusSummary();
+      expect(status.unfinalisedBlockNumber).toBe(3n);
+      await ws.close();
+      await rm(asyncDataDir, { recursive: true, maxRetries: 3 });
+    });
+
+    it('Rolls back a block that could not be written to all trees', async () => {
       // open ws against the same data dir but a different rollup and with a small max db size
       const rollupAddress = EthAddress.random();
       const ws = await NativeWorldStateService.new(rollupAddress, dataDir, 1024);
@@ -134,42 +157,32 @@ describe('NativeWorldState', () => {
 
       const { block: block1, messages: messages1 } = await mockBlock(1, 8, initialFork);
       const { block: block2, messages: messages2 } = await mockBlock(2, 8, initialFork);
-      const { block: block3, messages: messages3 } = await mockBlock(3, 8, initialFork);
 
       // The first block should succeed
       await expect(ws.handleL2BlockAndMessages(block1, messages1)).resolves.toBeDefined();
 
       // The trees should be synched at block 1
-      const goodSummary = await ws.getStatusSummary();
-      expect(goodSummary).toEqual({
+      const goodSummary = {
         unfinalisedBlockNumber: 1n,
         finalisedBlockNumber: 0n,
         oldestHistoricalBlock: 1n,
         treesAreSynched: true,
-      } as WorldStateStatusSummary);
+      } as WorldStateStatusSummary;
+      expect(await ws.getStatusSummary()).toEqual(goodSummary);
 
-      // The second block should fail
-      await expect(ws.handleL2BlockAndMessages(block2, messages2)).rejects.toThrow();
+      // The second block does not fit, it is rolled back from every tree
+      await expect(ws.handleL2BlockAndMessages(block2, messages2)).rejects.toThrow('it was rolled back');
+      expect(await ws.getStatusSummary()).toEqual(goodSummary);
 
-      // The summary should indicate that the unfinalised block number (that of the archive tree) is 2
-      // But it should also tell us that the trees are not synched
-      const badSummary = await ws.getStatusSummary();
-      expect(badSummary).toEqual({
-        unfinalisedBlockNumber: 2n,
-        finalisedBlockNumber: 0n,
-        oldestHistoricalBlock: 1n,
-        treesAreSynched: false,
-      } as WorldStateStatusSummary);
+      // Retrying fails the same way, without leaving the trees out of sync
+      await expect(ws.handleL2BlockAndMessages(block2, messages2)).rejects.toThrow('it was rolled back');
+      expect(await ws.getStatusSummary()).toEqual(goodSummary);
 
-      // Commits should always fail now, the trees are in an inconsistent state
-      await expect(ws.handleL2BlockAndMessages(block2, messages2)).rejects.toThrow('World state trees are out of sync');
-      await expect(ws.handleL2BlockAndMessages(block3, messages3)).rejects.toThrow('World state trees are out of sync');
-
-      // Creating another world state instance should fail
+      // The world state can be opened again at block 1
       await ws.close();
-      await expect(NativeWorldStateService.new(rollupAddress, dataDir, 1024)).rejects.toThrow(
-        'World state trees are out of sync',
-      );
+      const reopened = await NativeWorldStateService.new(rollupAddress, dataDir, 1024);
+      expect(await reopened.getStatusSummary()).toEqual(goodSummary);
+      await reopened.close();
     });
   });
 
@@ -535,6 +548,44 @@ describe('NativeWorldState', () => {
     });
   });
 
+  describe('sibling paths', () => {
+    beforeAll(async () => {
+      await rm(dataDir, { recursive: true, maxRetries: 3 });
+    });
+
+    it('retrieves many sibling paths across trees', async () => {
+      const ws = await NativeWorldStateService.new(rollupAddress, dataDir, defaultDBMapSize);
+      const fork = await ws.fork();
+      const { block, messages } = await mockBlock(1, 2, fork);
+      await fork.close();
+      await ws.handleL2BlockAndMessages(block, messages);
+
+      const queries = [
+        { treeId: MerkleTreeId.NOTE_HASH_TREE, leafIndices: [3n, 0n, 1n, 0n] },
+        { treeId: MerkleTreeId.NULLIFIER_TREE, leafIndices: [127n, 0n] },
+        { treeId: MerkleTreeId.ARCHIVE, leafIndices: [1n] },
+      ];
+      const committed = ws.getCommitted();
+      for (const blockNumber of [undefined, 1]) {
+        const results = await ws.getSiblingPaths(queries, blockNumber);
+        expect(results.length).toEqual(queries.length);
+        for (let i = 0; i < queries.length; i++) {
+          const { treeId, leafIndices } = queries[i];
+          for (let j = 0; j < leafIndices.length; j++) {
+            expect(results[i].paths[j]).toEqual(await committed.getSiblingPath(treeId, leafIndices[j]));
+            expect(results[i].leaves[j]).toBeDefined();
+          }
+        }
+      }
+
+      const archiveSize = (await committed.getTreeInfo(MerkleTreeId.ARCHIVE)).size;
+      await expect(
+        ws.getSiblingPaths([{ treeId: MerkleTreeId.ARCHIVE, leafIndices: [0n, archiveSize] }]),
+      ).rejects.toThrow();
+      await ws.close();
+    });
+  });
+
   describe('block numbers for indices', () => {
     let block: L2Block;
     let messages: Fr[];
@@ -714,6 +765,25 @@ describe('NativeWorldState', () => {
 
       await ws.close();
     });
+
+    it('reports message statistics by type', async () => {
+      const ws = await NativeWorldStateService.tmp();
+      const fork = await ws.fork();
+      await fork.close();
+
+      const stats = (await ws.getNativeStats(true)) as {
+        messages: Record<string, { count: number; utilization: number }>;
+      };
+      expect(stats.messages['CREATE_FORK'].count).toBeGreaterThanOrEqual(1);
+      expect(stats.messages['DELETE_FORK'].count).toEqual(1);
+      expect(stats.messages['DELETE_FORK'].utilization).toBeGreaterThanOrEqual(0);
+      expect(stats.messages['DELETE_FORK'].utilization).toBeLessThanOrEqual(1);
+
+      // Only the reset request itself was recorded since
+      const afterReset = (await ws.getNativeStats()) as { messages: Record<string, { count: number }> };
+      expect(afterReset.messages).toEqual({ GET_STATS: expect.objectContaining({ count: 1 }) });
+      await ws.close();
+    });
   });
 
   describe('Initialization args', () => {
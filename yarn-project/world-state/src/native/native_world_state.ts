@@ -3,6 +3,7 @@ import { padArrayEnd } from '@aztec/foundation/collection';
 import { EthAddress } from '@aztec/foundation/eth-address';
 import { Fr } from '@aztec/foundation/fields';
 import { createLogger } from '@aztec/foundation/log';
+import { SiblingPath } from '@aztec/foundation/trees';
 import type { L2Block } from '@aztec/stdlib/block';
 import { DatabaseVersionManager } from '@aztec/stdlib/database-version';
 import type {
@@ -36,7 +37,7 @@ import { NativeWorldState } from './native_world_state_instance.js';
 
 // The current version of the world state database schema
 // Increment this when making incompatible changes to the database schema
-export const WORLD_STATE_DB_VERSION = 1; // The initial version
+export const WORLD_STATE_DB_VERSION = 2; // Tree values stored with the fixed width encoding
 
 export class NativeWorldStateService implements MerkleTreeDatabase {
   protected initialHeader: BlockHeader | undefined;
@@ -148,7 +149,32 @@ export class NativeWorldStateService implements MerkleTreeDatabase {
     return this.initialHeader!;
   }
 
-  public async handleL2BlockAndMessages(l2Block: L2Block, l1ToL2Messages: Fr[]): Promise<WorldStateStatusFull> {
+  /**
+   * Gets the sibling paths and leaf hashes of many leaves, across trees, in a single call to the native module.
+   * Fails if any index is beyond the end of its tree.
+   * @param queries - The indices of the leaves to read, per tree
+   * @param blockNumber - The block to read the paths at, the latest committed state if undefined
+   * @returns The paths and leaf hashes of each query, in the order of its indices
+   */
+  public async getSiblingPaths(
+    queries: { treeId: MerkleTreeId; leafIndices: bigint[] }[],
+    blockNumber?: number,
+  ): Promise<{ paths: SiblingPath<number>[]; leaves: (Fr | undefined)[] }[]> {
+    const response = await this.instance.call(WorldStateMessageType.GET_SIBLING_PATHS, {
+      queries,
+      revision: worldStateRevision(false, 0, blockNumber),
+    });
+    return response.trees.map(tree => ({
+      paths: tree.paths.map(path => new SiblingPath(path.length, path)),
+      leaves: tree.leaves.map(leaf => (leaf ? Fr.fromBuffer(leaf) : undefined)),
+    }));
+  }
+
+  public async handleL2BlockAndMessages(
+    l2Block: L2Block,
+    l1ToL2Messages: Fr[],
+    waitForPersisted = true,
+  ): Promise<WorldStateStatusFull> {
     // We have to pad both the values within tx effects because that's how the trees are built by circuits.
     const paddedNoteHashes = l2Block.body.txEffects.flatMap(txEffect =>
       padArrayEnd(txEffect.noteHashes, Fr.ZERO, MAX_NOTE_HASHES_PER_TX),
@@ -179,6 +205,7 @@ export class NativeWorldStateService implements MerkleTreeDatabase {
           paddedNullifiers: paddedNullifiers.map(serializeLeaf),
           publicDataWrites: publicDataWrites.map(serializeLeaf),
           blockStateRef: blockStateReference(l2Block.header.state),
+          waitForPersisted,
           canonical: true,
         },
         this.sanitiseAndCacheSummaryFromFull.bind(this),
@@ -190,6 +217,24 @@ export class NativeWorldStateService implements MerkleTreeDatabase {
     }
   }
 
+  /**
+   * Waits for the last block handled without waiting for it to be written to disk. If it could not be written, the
+   * world state is rolled back to the block before it and this throws.
+   */
+  public async waitForPersisted(): Promise<void> {
+    try {
+      await this.instance.call(
+        WorldStateMessageType.WAIT_FOR_PERSISTED,
+        { canonical: true },
+        response => response,
+        this.deleteCachedSummary.bind(this),
+      );
+    } catch (err) {
+      this.worldStateInstrumentation.incCriticalErrors('synch_pending_block');
+      throw err;
+    }
+  }
+
   public async close(): Promise<void> {
     await this.instance.close();
     await this.cleanup();
@@ -283,6 +328,16 @@ export class NativeWorldStateService implements MerkleTreeDatabase {
     }
   }
 
+  /**
+   * Returns the statistics of the native world state: the number of messages of each type and the wall time spent on
+   * them, the peak memory usage and the number of threads, as reported by the native module.
+   * @param reset - Whether to zero the message statistics once read, e.g. to report them per interval
+   */
+  public async getNativeStats(reset = false): Promise<Record<string, unknown>> {
+    const response = await this.instance.call(WorldStateMessageType.GET_STATS, { canonical: true, reset });
+    return JSON.parse(response.stats);
+  }
+
   public async getStatusSummary() {
     if (this.cachedStatusSummary !== undefined) {
       return { ...this.cachedStatusSummary };
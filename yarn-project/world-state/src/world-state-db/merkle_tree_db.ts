@@ -39,8 +39,20 @@ export interface MerkleTreeAdminDatabase extends ForkMerkleTreeOperations {
    * Handles a single L2 block (i.e. Inserts the new note hashes into the merkle tree).
    * @param block - The L2 block to handle.
    * @param l1ToL2Messages - The L1 to L2 messages for the block.
+   * @param waitForPersisted - Whether to wait for the block to be written to disk, otherwise it is only durable once
+   * waitForPersisted resolves. Defaults to true.
    */
-  handleL2BlockAndMessages(block: L2Block, l1ToL2Messages: Fr[]): Promise<WorldStateStatusFull>;
+  handleL2BlockAndMessages(
+    block: L2Block,
+    l1ToL2Messages: Fr[],
+    waitForPersisted?: boolean,
+  ): Promise<WorldStateStatusFull>;
+
+  /**
+   * Waits for the last block handled without waiting for it to be written to disk.
+   * Throws if it could not be written, in which case the world state is rolled back to the block before it.
+   */
+  waitForPersisted(): Promise<void>;
 
   /**
    * Gets a handle that allows reading the latest committed state